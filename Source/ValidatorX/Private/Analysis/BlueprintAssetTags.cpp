@@ -0,0 +1,175 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintCostModel.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Analysis/BlueprintHardReferences.h"
+#include "Analysis/BlueprintMetrics.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Components/ActorComponent.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_Event.h"
+#include "Misc/PackageName.h"
+#include "Reporting/IssueLog.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+namespace ValidatorX
+{
+	namespace
+	{
+		FDelegateHandle AssetTagsHandle;
+
+		void AddNumericTag(FAssetRegistryTagsContext& Context, FName Tag, int32 Value)
+		{
+			Context.AddTag(UObject::FAssetRegistryTag(Tag, LexToString(Value), UObject::FAssetRegistryTag::TT_Numerical));
+		}
+
+		void AddFingerprintTag(FAssetRegistryTagsContext& Context, uint64 Fingerprint)
+		{
+			Context.AddTag(UObject::FAssetRegistryTag(AssetTags::LastValidationFingerprint, FString::Printf(TEXT("%016llx"), Fingerprint), UObject::FAssetRegistryTag::TT_Alphabetical));
+		}
+
+		void AddBlueprintAssetTags(FAssetRegistryTagsContext Context)
+		{
+			// Tags are gathered for every registry query on loaded objects too; the analysis below only pays off on save
+			if(!Context.IsSaving())
+			{
+				return;
+			}
+
+			const UBlueprint* Blueprint = Cast<UBlueprint>(Context.GetObject());
+			if(!Blueprint)
+			{
+				return;
+			}
+
+			const int32 NumDispatchers = Blueprint->NewVariables.FilterByPredicate([] (const FBPVariableDescription& Variable)
+				{
+					return Variable.VarType.PinCategory == UEdGraphSchema_K2::PC_MCDelegate || Variable.VarType.PinCategory == UEdGraphSchema_K2::PC_Delegate;
+				}).Num();
+
+			AddNumericTag(Context, AssetTags::NumVariables, Blueprint->NewVariables.Num());
+			AddNumericTag(Context, AssetTags::NumFunctions, Blueprint->FunctionGraphs.Num());
+			AddNumericTag(Context, AssetTags::NumMacros, Blueprint->MacroGraphs.Num());
+			AddNumericTag(Context, AssetTags::NumDispatchers, NumDispatchers);
+
+			const FValidatorXBlueprintMetrics Metrics = GatherBlueprintMetrics(Blueprint);
+			AddNumericTag(Context, AssetTags::NumGraphs, Metrics.NumGraphs);
+			AddNumericTag(Context, AssetTags::NumNodes, Metrics.NumNodes);
+			AddNumericTag(Context, AssetTags::MaxGraphNodes, Metrics.MaxGraphNodes);
+			AddNumericTag(Context, AssetTags::NumMacroInstances, Metrics.NumMacroInstances);
+
+			TArray<UEdGraphNode*> TickingEvents;
+			for(const TCHAR* EventName : { TEXT("ReceiveTick"), TEXT("Tick"), TEXT("BlueprintUpdateAnimation") })
+			{
+				if(UK2Node_Event* Event = FindEventNode(Blueprint, FName(EventName)))
+				{
+					TickingEvents.Add(Event);
+				}
+			}
+
+			TSet<UEdGraphNode*> TickNodes;
+			if(TickingEvents.Num() > 0)
+			{
+				CollectExecReachableNodes(Blueprint, TickingEvents, TickNodes);
+			}
+			AddNumericTag(Context, AssetTags::NumTickingEvents, TickingEvents.Num());
+
+			// What the engine ticks, whether or not a Tick event is implemented in the graphs
+			const UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject(false) : nullptr;
+			bool bCanEverTick = false;
+			if(const AActor* Actor = Cast<AActor>(DefaultObject))
+			{
+				bCanEverTick = Actor->PrimaryActorTick.bCanEverTick;
+			}
+			else if(const UActorComponent* Component = Cast<UActorComponent>(DefaultObject))
+			{
+				bCanEverTick = Component->PrimaryComponentTick.bCanEverTick;
+			}
+			AddNumericTag(Context, AssetTags::CanEverTick, bCanEverTick ? 1 : 0);
+			AddNumericTag(Context, AssetTags::EstimatedTickCost, EstimateNodesCost(TickNodes));
+
+			TArray<FValidatorXReferenceEdge> Edges;
+			CollectHardReferenceEdges(Blueprint, Edges);
+			TSet<FName> ReferencedPackages;
+			for(const FValidatorXReferenceEdge& Edge : Edges)
+			{
+				ReferencedPackages.Add(Edge.PackageName);
+			}
+			AddNumericTag(Context, AssetTags::NumHardReferences, ReferencedPackages.Num());
+
+			// Only known when the package was validated in this session, otherwise the registry keeps the previous values
+			const FName PackageName = Blueprint->GetOutermost()->GetFName();
+			const FValidatorXIssueLog& IssueLog = FValidatorXIssueLog::Get();
+			if(IssueLog.WasValidated(PackageName))
+			{
+				int32 NumIssues = 0;
+				const uint64 Fingerprint = IssueLog.GetPackageFingerprint(PackageName, NumIssues);
+				AddNumericTag(Context, AssetTags::NumIssues, NumIssues);
+				AddFingerprintTag(Context, Fingerprint);
+			}
+			else if(const IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+			{
+				const FAssetData PreviousData = AssetRegistry->GetAssetByObjectPath(FSoftObjectPath(Blueprint));
+				const int32 NumIssues = GetAssetTagCount(PreviousData, AssetTags::NumIssues);
+				if(NumIssues != INDEX_NONE)
+				{
+					AddNumericTag(Context, AssetTags::NumIssues, NumIssues);
+					AddFingerprintTag(Context, GetAssetTagFingerprint(PreviousData));
+				}
+			}
+		}
+	}
+
+	void RegisterAssetTags()
+	{
+		AssetTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddStatic(&AddBlueprintAssetTags);
+	}
+
+	void UnregisterAssetTags()
+	{
+		UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(AssetTagsHandle);
+	}
+
+	int32 GetAssetTagCount(const FAssetData& AssetData, FName Tag)
+	{
+		int32 Value = INDEX_NONE;
+		return AssetData.GetTagValue(Tag, Value) ? Value : INDEX_NONE;
+	}
+
+	uint64 GetAssetTagFingerprint(const FAssetData& AssetData)
+	{
+		FString Fingerprint;
+		return AssetData.GetTagValue(AssetTags::LastValidationFingerprint, Fingerprint) ? FCString::Strtoui64(*Fingerprint, nullptr, 16) : 0;
+	}
+
+	bool IsDataOnlyBlueprint(const FAssetData& AssetData)
+	{
+		bool bIsDataOnly = false;
+		return AssetData.GetTagValue(FBlueprintTags::IsDataOnly, bIsDataOnly) && bIsDataOnly;
+	}
+
+	bool IsNativeParentChildOf(const FAssetData& AssetData, const UClass* Class)
+	{
+		FString NativeParentPath;
+		if(!Class || !AssetData.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentPath))
+		{
+			return true;
+		}
+
+		// Native classes are always loaded, the lookup never loads anything
+		const UClass* NativeParent = FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+		return !NativeParent || NativeParent->IsChildOf(Class);
+	}
+
+	bool HasGeneratedClassFlags(const FAssetData& AssetData, EClassFlags Flags)
+	{
+		uint32 ClassFlags = 0;
+		return AssetData.GetTagValue(FBlueprintTags::ClassFlags, ClassFlags) && (ClassFlags & Flags) != 0;
+	}
+}
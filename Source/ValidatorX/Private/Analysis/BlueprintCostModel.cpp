@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintCostModel.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ConstructObjectFromClass.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_Knot.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_SpawnActor.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+
+namespace ValidatorX
+{
+	namespace CostModel
+	{
+		constexpr int32 TrivialCost = 1;
+		constexpr int32 CastCost = 2;
+		constexpr int32 CallCost = 3;
+		constexpr int32 LoopCost = 20;
+		constexpr int32 WorldQueryCost = 25;
+		constexpr int32 CreationCost = 50;
+	}
+
+	bool IsWorldQueryNode(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		if(!CallNode)
+		{
+			return false;
+		}
+
+		const FString FunctionName = CallNode->FunctionReference.GetMemberName().ToString();
+		return FunctionName.StartsWith(TEXT("GetAllActors"))
+			|| FunctionName.StartsWith(TEXT("GetAllWidgetsOfClass"))
+			|| FunctionName.StartsWith(TEXT("FindAllWidgets"))
+			|| FunctionName.Contains(TEXT("Trace"))
+			|| FunctionName.Contains(TEXT("Overlap"))
+			|| FunctionName.StartsWith(TEXT("GetComponentsByClass"))
+			|| FunctionName.StartsWith(TEXT("GetComponentsByTag"));
+	}
+
+	bool IsObjectCreationNode(const UEdGraphNode* Node)
+	{
+		if(Node && (Node->IsA<UK2Node_ConstructObjectFromClass>() || Node->IsA<UK2Node_SpawnActor>()))
+		{
+			return true;
+		}
+
+		if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			const FName FunctionName = CallNode->FunctionReference.GetMemberName();
+			return FunctionName == TEXT("BeginDeferredActorSpawnFromClass")
+				|| FunctionName == TEXT("SpawnObject")
+				|| FunctionName == TEXT("Create");
+		}
+		return false;
+	}
+
+	bool IsLoopMacroNode(const UEdGraphNode* Node)
+	{
+		const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node);
+		const UEdGraph* MacroGraph = MacroNode ? MacroNode->GetMacroGraph() : nullptr;
+		if(!MacroGraph)
+		{
+			return false;
+		}
+
+		const FString MacroName = MacroGraph->GetName();
+		return MacroName.Contains(TEXT("ForEach")) || MacroName.StartsWith(TEXT("ForLoop")) || MacroName.StartsWith(TEXT("WhileLoop"));
+	}
+
+	int32 EstimateNodeCost(const UEdGraphNode* Node)
+	{
+		if(!Node || Node->IsA<UEdGraphNode_Comment>() || Node->IsA<UK2Node_Knot>()
+			|| Node->IsA<UK2Node_FunctionEntry>() || Node->IsA<UK2Node_FunctionResult>())
+		{
+			return 0;
+		}
+
+		if(IsObjectCreationNode(Node)) return CostModel::CreationCost;
+		if(IsWorldQueryNode(Node)) return CostModel::WorldQueryCost;
+		if(IsLoopMacroNode(Node)) return CostModel::LoopCost;
+		if(Node->IsA<UK2Node_DynamicCast>()) return CostModel::CastCost;
+		if(Node->IsA<UK2Node_CallFunction>() || Node->IsA<UK2Node_MacroInstance>()) return CostModel::CallCost;
+
+		return CostModel::TrivialCost;
+	}
+
+	int32 EstimateNodesCost(const TSet<UEdGraphNode*>& Nodes)
+	{
+		int32 TotalCost = 0;
+		for(const UEdGraphNode* Node : Nodes)
+		{
+			TotalCost += EstimateNodeCost(Node);
+		}
+		return TotalCost;
+	}
+}
@@ -0,0 +1,160 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintExecFlow.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+
+namespace ValidatorX
+{
+	UK2Node_Event* FindEventNode(const UBlueprint* Blueprint, FName EventName)
+	{
+		if(!Blueprint)
+		{
+			return nullptr;
+		}
+
+		for(UEdGraph* Graph : Blueprint->UbergraphPages)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node);
+				if(EventNode && EventNode->GetFunctionName() == EventName)
+				{
+					return EventNode;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool HasExecPins(const UEdGraphNode* Node)
+	{
+		if(!Node)
+		{
+			return false;
+		}
+
+		for(const UEdGraphPin* Pin : Node->Pins)
+		{
+			if(Pin && Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void CollectExecReachableNodes(const UBlueprint* Blueprint, TArrayView<UEdGraphNode* const> Roots, TSet<UEdGraphNode*>& OutNodes)
+	{
+		if(!Blueprint)
+		{
+			return;
+		}
+
+		// Entry points of everything a call node in this Blueprint can jump into
+		TMap<FName, UEdGraphNode*> LocalEntries;
+		for(UEdGraph* Graph : Blueprint->FunctionGraphs)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(Node && Node->IsA<UK2Node_FunctionEntry>())
+				{
+					LocalEntries.Add(Graph->GetFName(), Node);
+					break;
+				}
+			}
+		}
+		for(UEdGraph* Graph : Blueprint->UbergraphPages)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+				{
+					LocalEntries.Add(CustomEvent->CustomFunctionName, Node);
+				}
+			}
+		}
+
+		TArray<UEdGraphNode*> Stack;
+		for(UEdGraphNode* Root : Roots)
+		{
+			if(Root && !OutNodes.Contains(Root))
+			{
+				OutNodes.Add(Root);
+				Stack.Push(Root);
+			}
+		}
+
+		auto Visit = [&OutNodes, &Stack] (UEdGraphNode* Node)
+			{
+				if(Node)
+				{
+					bool bAlreadyVisited = false;
+					OutNodes.Add(Node, &bAlreadyVisited);
+					if(!bAlreadyVisited)
+					{
+						Stack.Push(Node);
+					}
+				}
+			};
+
+		while(Stack.Num() > 0)
+		{
+			UEdGraphNode* Node = Stack.Pop();
+
+			for(const UEdGraphPin* Pin : Node->Pins)
+			{
+				if(!Pin) continue;
+
+				const bool bIsExec = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+				if(bIsExec && Pin->Direction == EGPD_Output)
+				{
+					for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						Visit(LinkedPin ? LinkedPin->GetOwningNode() : nullptr);
+					}
+				}
+				else if(!bIsExec && Pin->Direction == EGPD_Input)
+				{
+					// Pure producers are evaluated together with their consumer
+					for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+					{
+						UEdGraphNode* Producer = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+						if(Producer && !HasExecPins(Producer))
+						{
+							Visit(Producer);
+						}
+					}
+				}
+			}
+
+			if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				const UClass* MemberParent = CallNode->FunctionReference.GetMemberParentClass();
+				const bool bIsLocalCall = CallNode->FunctionReference.IsSelfContext()
+					|| (MemberParent && (MemberParent == Blueprint->GeneratedClass || MemberParent == Blueprint->SkeletonGeneratedClass));
+
+				if(bIsLocalCall)
+				{
+					if(UEdGraphNode** Entry = LocalEntries.Find(CallNode->FunctionReference.GetMemberName()))
+					{
+						Visit(*Entry);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,139 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintHardReferences.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_ConstructObjectFromClass.h"
+#include "K2Node_DynamicCast.h"
+#include "Misc/PackageName.h"
+
+namespace ValidatorX
+{
+	bool IsHardReferencePinCategory(const FName& PinCategory)
+	{
+		return PinCategory == UEdGraphSchema_K2::PC_Object
+			|| PinCategory == UEdGraphSchema_K2::PC_Class
+			|| PinCategory == UEdGraphSchema_K2::PC_Interface
+			|| PinCategory == UEdGraphSchema_K2::PC_Struct;
+	}
+
+	void CollectHardReferenceEdges(const UBlueprint* Blueprint, TArray<FValidatorXReferenceEdge>& OutEdges)
+	{
+		if(!Blueprint)
+		{
+			return;
+		}
+
+		const FName OwnPackageName = Blueprint->GetOutermost()->GetFName();
+		TSet<TTuple<FName, const UEdGraphNode*, FString>> SeenEdges;
+
+		auto AddEdge = [&] (const UObject* Object, EValidatorXReferenceKind Kind, const FString& SourceName, UEdGraph* Graph, UEdGraphNode* Node)
+			{
+				if(!Object)
+				{
+					return;
+				}
+
+				const UPackage* Package = Object->GetOutermost();
+				const FName PackageName = Package->GetFName();
+				if(PackageName == OwnPackageName || Package->HasAnyPackageFlags(PKG_CompiledIn) || FPackageName::IsScriptPackage(PackageName.ToString()))
+				{
+					return;
+				}
+
+				bool bAlreadySeen = false;
+				SeenEdges.Add(MakeTuple(PackageName, static_cast<const UEdGraphNode*>(Node), SourceName), &bAlreadySeen);
+				if(bAlreadySeen)
+				{
+					return;
+				}
+
+				FValidatorXReferenceEdge& Edge = OutEdges.AddDefaulted_GetRef();
+				Edge.PackageName = PackageName;
+				Edge.ReferencedObject = Object;
+				Edge.Kind = Kind;
+				Edge.SourceName = SourceName;
+				Edge.Graph = Graph;
+				Edge.Node = Node;
+			};
+
+		AddEdge(Blueprint->ParentClass, EValidatorXReferenceKind::ParentClass, TEXT("Parent Class"), nullptr, nullptr);
+
+		for(const FBPVariableDescription& Variable : Blueprint->NewVariables)
+		{
+			if(IsHardReferencePinCategory(Variable.VarType.PinCategory))
+			{
+				AddEdge(Variable.VarType.PinSubCategoryObject.Get(), EValidatorXReferenceKind::Variable, Variable.VarName.ToString(), nullptr, nullptr);
+			}
+			if(IsHardReferencePinCategory(Variable.VarType.PinValueType.TerminalCategory))
+			{
+				AddEdge(Variable.VarType.PinValueType.TerminalSubCategoryObject.Get(), EValidatorXReferenceKind::Variable, Variable.VarName.ToString(), nullptr, nullptr);
+			}
+		}
+
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint->GetAllGraphs(AllGraphs);
+
+		for(UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(!Node) continue;
+
+				const FString NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+
+				if(const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
+				{
+					AddEdge(CastNode->TargetType, EValidatorXReferenceKind::Cast, NodeTitle, Graph, Node);
+				}
+				else if(const UK2Node_ConstructObjectFromClass* SpawnNode = Cast<UK2Node_ConstructObjectFromClass>(Node))
+				{
+					if(const UEdGraphPin* ClassPin = SpawnNode->GetClassPin())
+					{
+						AddEdge(ClassPin->DefaultObject, EValidatorXReferenceKind::SpawnNode, NodeTitle, Graph, Node);
+					}
+				}
+				else if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+				{
+					if(const UFunction* Function = CallNode->GetTargetFunction())
+					{
+						const UClass* OwnerClass = Function->GetOwnerClass();
+						if(OwnerClass && OwnerClass->ClassGeneratedBy)
+						{
+							AddEdge(OwnerClass, EValidatorXReferenceKind::FunctionCall, NodeTitle, Graph, Node);
+						}
+					}
+				}
+
+				for(const UEdGraphPin* Pin : Node->Pins)
+				{
+					if(!Pin || !IsHardReferencePinCategory(Pin->PinType.PinCategory)) continue;
+
+					AddEdge(Pin->PinType.PinSubCategoryObject.Get(), EValidatorXReferenceKind::PinType, NodeTitle, Graph, Node);
+					AddEdge(Pin->DefaultObject, EValidatorXReferenceKind::PinDefault, NodeTitle, Graph, Node);
+				}
+			}
+		}
+	}
+
+	const TCHAR* LexReferenceKind(EValidatorXReferenceKind Kind)
+	{
+		switch(Kind)
+		{
+		case EValidatorXReferenceKind::ParentClass:  return TEXT("Parent class");
+		case EValidatorXReferenceKind::Variable:     return TEXT("Variable");
+		case EValidatorXReferenceKind::Cast:         return TEXT("Cast node");
+		case EValidatorXReferenceKind::SpawnNode:    return TEXT("Spawn node");
+		case EValidatorXReferenceKind::FunctionCall: return TEXT("Function call");
+		case EValidatorXReferenceKind::PinType:      return TEXT("Pin type");
+		case EValidatorXReferenceKind::PinDefault:   return TEXT("Pin default");
+		default:                                     return TEXT("Reference");
+		}
+	}
+}
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintMetrics.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_Knot.h"
+#include "K2Node_MacroInstance.h"
+
+namespace ValidatorX
+{
+	FValidatorXBlueprintMetrics GatherBlueprintMetrics(const UBlueprint* Blueprint)
+	{
+		FValidatorXBlueprintMetrics Metrics;
+		if(!Blueprint)
+		{
+			return Metrics;
+		}
+
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint->GetAllGraphs(AllGraphs);
+
+		for(const UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			int32 GraphNodes = 0;
+			for(const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(!Node || Node->IsA<UEdGraphNode_Comment>() || Node->IsA<UK2Node_Knot>()) continue;
+
+				GraphNodes++;
+				Metrics.NumMacroInstances += Node->IsA<UK2Node_MacroInstance>() ? 1 : 0;
+			}
+
+			Metrics.NumGraphs++;
+			Metrics.NumNodes += GraphNodes;
+			Metrics.MaxGraphNodes = FMath::Max(Metrics.MaxGraphNodes, GraphNodes);
+		}
+
+		return Metrics;
+	}
+}
@@ -0,0 +1,270 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintSimilarity.h"
+#include "Analysis/BlueprintSnapshot.h"
+#include "Analysis/SubgraphHasher.h"
+#include "Algo/Unique.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "K2Node_Knot.h"
+
+namespace ValidatorX
+{
+	constexpr int32 MaxFullyComparedBucket = 64;
+
+	/** SplitMix64 finalizer, a cheap bijective mix used to derive one MinHash permutation per row */
+	inline uint64 MixHash(uint64 Value)
+	{
+		Value ^= Value >> 30;
+		Value *= 0xBF58476D1CE4E5B9ull;
+		Value ^= Value >> 27;
+		Value *= 0x94D049BB133111EBull;
+		Value ^= Value >> 31;
+		return Value;
+	}
+
+	void CollectBlueprintShingles(const UBlueprint* Blueprint, TArray<uint64>& OutShingles)
+	{
+		OutShingles.Reset();
+		if(!Blueprint)
+		{
+			return;
+		}
+
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint->GetAllGraphs(AllGraphs);
+
+		TMap<const UEdGraphNode*, uint64> NodeKeys;
+		for(const UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			for(const UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(!Node || Node->IsA<UEdGraphNode_Comment>() || Node->IsA<UK2Node_Knot>()) continue;
+
+				const uint64 Key = HashStableString(GetCanonicalNodeKey(Node));
+				NodeKeys.Add(Node, Key);
+				OutShingles.Add(Key);
+			}
+		}
+
+		for(const TPair<const UEdGraphNode*, uint64>& Pair : NodeKeys)
+		{
+			for(const UEdGraphPin* Pin : Pair.Key->Pins)
+			{
+				if(!Pin || Pin->Direction != EGPD_Output) continue;
+
+				for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					if(const uint64* TargetKey = NodeKeys.Find(LinkedPin->GetOwningNode()))
+					{
+						OutShingles.Add(CombineStableHash(Pair.Value, *TargetKey));
+					}
+				}
+			}
+		}
+
+		OutShingles.Sort();
+		OutShingles.SetNum(Algo::Unique(OutShingles));
+	}
+
+	void CollectSnapshotShingles(const FValidatorXSnapshotReader& Snapshot, int32 BlueprintIndex, TArray<uint64>& OutShingles)
+	{
+		using namespace ValidatorX::Snapshot;
+
+		OutShingles.Reset();
+
+		const FBlueprintRecord& Blueprint = Snapshot.GetBlueprints()[BlueprintIndex];
+		const TConstArrayView<FGraphRecord> Graphs = Snapshot.GetGraphs();
+		const TConstArrayView<FNodeRecord> Nodes = Snapshot.GetNodes();
+		const TConstArrayView<FPinRecord> Pins = Snapshot.GetPins();
+		const TConstArrayView<FLinkRecord> Links = Snapshot.GetLinks();
+
+		TMap<uint32, uint64> NodeKeys;
+		for(uint32 GraphIndex = Blueprint.FirstGraph; GraphIndex < Blueprint.FirstGraph + Blueprint.NumGraphs; ++GraphIndex)
+		{
+			const FGraphRecord& Graph = Graphs[GraphIndex];
+			for(uint32 NodeIndex = Graph.FirstNode; NodeIndex < Graph.FirstNode + Graph.NumNodes; ++NodeIndex)
+			{
+				if(Nodes[NodeIndex].Flags & (NodeFlag_Comment | NodeFlag_Knot)) continue;
+
+				const FUtf8StringView KeyView = Snapshot.GetString(Nodes[NodeIndex].Key);
+				const uint64 Key = HashStableString(FString(KeyView.Len(), KeyView.GetData()));
+				NodeKeys.Add(NodeIndex, Key);
+				OutShingles.Add(Key);
+			}
+		}
+
+		for(const TPair<uint32, uint64>& Pair : NodeKeys)
+		{
+			const FNodeRecord& Node = Nodes[Pair.Key];
+			for(uint32 PinIndex = Node.FirstPin; PinIndex < Node.FirstPin + Node.NumPins; ++PinIndex)
+			{
+				const FPinRecord& Pin = Pins[PinIndex];
+				if(Pin.Direction != EGPD_Output) continue;
+
+				for(uint32 LinkIndex = Pin.FirstLink; LinkIndex < Pin.FirstLink + Pin.NumLinks; ++LinkIndex)
+				{
+					if(const uint64* TargetKey = NodeKeys.Find(Pins[Links[LinkIndex].TargetPin].Node))
+					{
+						OutShingles.Add(CombineStableHash(Pair.Value, *TargetKey));
+					}
+				}
+			}
+		}
+
+		OutShingles.Sort();
+		OutShingles.SetNum(Algo::Unique(OutShingles));
+	}
+}
+
+FValidatorXMinHashIndex::FValidatorXMinHashIndex(int32 InNumBands, int32 InRowsPerBand)
+	: NumBands(FMath::Max(1, InNumBands))
+	, RowsPerBand(FMath::Max(1, InRowsPerBand))
+{
+	NumRows = NumBands * RowsPerBand;
+
+	Seeds.SetNumUninitialized(NumRows);
+	for(int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Seeds[Row] = ValidatorX::MixHash(0x5EED0000ull + Row);
+	}
+
+	BandBuckets.SetNum(NumBands);
+}
+
+int32 FValidatorXMinHashIndex::Add(TConstArrayView<uint64> Shingles)
+{
+	const int32 Index = NumItems++;
+	const int32 Offset = Signatures.AddUninitialized(NumRows);
+	uint64* Signature = Signatures.GetData() + Offset;
+
+	for(int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Signature[Row] = MAX_uint64;
+	}
+
+	if(Shingles.Num() == 0)
+	{
+		return Index;
+	}
+
+	for(const uint64 Shingle : Shingles)
+	{
+		for(int32 Row = 0; Row < NumRows; ++Row)
+		{
+			Signature[Row] = FMath::Min(Signature[Row], ValidatorX::MixHash(Shingle ^ Seeds[Row]));
+		}
+	}
+
+	for(int32 Band = 0; Band < NumBands; ++Band)
+	{
+		uint64 BandHash = Band;
+		for(int32 Row = 0; Row < RowsPerBand; ++Row)
+		{
+			BandHash = ValidatorX::CombineStableHash(BandHash, Signature[Band * RowsPerBand + Row]);
+		}
+		BandBuckets[Band].FindOrAdd(BandHash).Add(Index);
+	}
+
+	return Index;
+}
+
+float FValidatorXMinHashIndex::EstimateSimilarity(int32 A, int32 B) const
+{
+	const uint64* SignatureA = Signatures.GetData() + A * NumRows;
+	const uint64* SignatureB = Signatures.GetData() + B * NumRows;
+
+	int32 Matches = 0;
+	for(int32 Row = 0; Row < NumRows; ++Row)
+	{
+		Matches += SignatureA[Row] == SignatureB[Row] ? 1 : 0;
+	}
+	return static_cast<float>(Matches) / NumRows;
+}
+
+void FValidatorXMinHashIndex::FindSimilarPairs(float MinSimilarity, TArray<FSimilarPair>& OutPairs) const
+{
+	TSet<uint64> TestedPairs;
+
+	for(const TMap<uint64, TArray<int32>>& Buckets : BandBuckets)
+	{
+		for(const TPair<uint64, TArray<int32>>& Bucket : Buckets)
+		{
+			// Huge buckets (many copies of the same class) are only compared against their first item,
+			// clustering still joins them and the pair count stays linear
+			const TArray<int32>& Items = Bucket.Value;
+			const int32 NumAnchors = Items.Num() > ValidatorX::MaxFullyComparedBucket ? 1 : Items.Num();
+			for(int32 First = 0; First < NumAnchors; ++First)
+			{
+				for(int32 Second = First + 1; Second < Items.Num(); ++Second)
+				{
+					const int32 A = FMath::Min(Items[First], Items[Second]);
+					const int32 B = FMath::Max(Items[First], Items[Second]);
+
+					bool bAlreadyTested = false;
+					TestedPairs.Add((static_cast<uint64>(A) << 32) | static_cast<uint32>(B), &bAlreadyTested);
+					if(bAlreadyTested) continue;
+
+					const float Similarity = EstimateSimilarity(A, B);
+					if(Similarity >= MinSimilarity)
+					{
+						OutPairs.Add({ A, B, Similarity });
+					}
+				}
+			}
+		}
+	}
+}
+
+void FValidatorXMinHashIndex::BuildClusters(int32 NumItems, const TArray<FSimilarPair>& Pairs, TArray<TArray<int32>>& OutClusters)
+{
+	TArray<int32> Parents;
+	Parents.SetNumUninitialized(NumItems);
+	for(int32 Index = 0; Index < NumItems; ++Index)
+	{
+		Parents[Index] = Index;
+	}
+
+	auto FindRoot = [&Parents] (int32 Index)
+		{
+			while(Parents[Index] != Index)
+			{
+				Parents[Index] = Parents[Parents[Index]];
+				Index = Parents[Index];
+			}
+			return Index;
+		};
+
+	for(const FSimilarPair& Pair : Pairs)
+	{
+		const int32 RootA = FindRoot(Pair.A);
+		const int32 RootB = FindRoot(Pair.B);
+		if(RootA != RootB)
+		{
+			Parents[RootB] = RootA;
+		}
+	}
+
+	TMap<int32, int32> ClusterIndices;
+	for(int32 Index = 0; Index < NumItems; ++Index)
+	{
+		// Roots are added when their cluster is created, singletons never create one
+		const int32 Root = FindRoot(Index);
+		if(Root == Index)
+		{
+			continue;
+		}
+
+		int32& ClusterIndex = ClusterIndices.FindOrAdd(Root, INDEX_NONE);
+		if(ClusterIndex == INDEX_NONE)
+		{
+			ClusterIndex = OutClusters.AddDefaulted();
+			OutClusters[ClusterIndex].Add(Root);
+		}
+		OutClusters[ClusterIndex].Add(Index);
+	}
+}
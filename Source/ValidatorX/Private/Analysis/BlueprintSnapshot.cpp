@@ -0,0 +1,363 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/BlueprintSnapshot.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Analysis/SubgraphHasher.h"
+#include "Async/MappedFileHandle.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Knot.h"
+#include "K2Node_Variable.h"
+#include "Misc/FileHelper.h"
+
+namespace ValidatorX::Snapshot
+{
+	constexpr uint64 SectionAlignment = 8;
+
+	/** Size of one record of each section, used to bounds check mapped shards */
+	constexpr uint64 RecordSizes[static_cast<uint32>(ESection::Count)] =
+	{
+		sizeof(FBlueprintRecord),
+		sizeof(FGraphRecord),
+		sizeof(FNodeRecord),
+		sizeof(FPinRecord),
+		sizeof(FLinkRecord),
+		sizeof(FVariableRecord),
+		sizeof(uint32),
+		sizeof(uint8),
+	};
+
+	EGraphKind GetGraphKind(const UBlueprint* Blueprint, const UEdGraph* Graph)
+	{
+		if(Blueprint->UbergraphPages.Contains(Graph)) return EGraphKind::Ubergraph;
+		if(Blueprint->FunctionGraphs.Contains(Graph)) return EGraphKind::Function;
+		if(Blueprint->MacroGraphs.Contains(Graph)) return EGraphKind::Macro;
+		return EGraphKind::Other;
+	}
+
+	FString GetPinDefaultValue(const UEdGraphPin* Pin)
+	{
+		if(Pin->DefaultObject)
+		{
+			return Pin->DefaultObject->GetPathName();
+		}
+		if(!Pin->DefaultTextValue.IsEmpty())
+		{
+			return Pin->DefaultTextValue.BuildSourceString();
+		}
+		return Pin->DefaultValue;
+	}
+}
+
+uint32 FValidatorXSnapshotWriter::AddString(const FString& Value)
+{
+	if(const uint32* Existing = StringIndices.Find(Value))
+	{
+		return *Existing;
+	}
+
+	if(StringOffsets.Num() == 0)
+	{
+		StringOffsets.Add(0);
+	}
+
+	const FTCHARToUTF8 Converted(*Value);
+	StringData.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+
+	const uint32 Index = StringOffsets.Num() - 1;
+	StringOffsets.Add(StringData.Num());
+	StringIndices.Add(Value, Index);
+	return Index;
+}
+
+void FValidatorXSnapshotWriter::AddBlueprint(const UBlueprint* Blueprint)
+{
+	using namespace ValidatorX::Snapshot;
+
+	if(!Blueprint)
+	{
+		return;
+	}
+
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+	AllGraphs.RemoveAll([] (const UEdGraph* Graph) { return Graph == nullptr; });
+
+	// Pin indices are assigned up front so links can point forward
+	TMap<const UEdGraphPin*, uint32> PinIndices;
+	uint32 NextPinIndex = Pins.Num();
+	for(const UEdGraph* Graph : AllGraphs)
+	{
+		for(const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if(!Node) continue;
+
+			for(const UEdGraphPin* Pin : Node->Pins)
+			{
+				if(Pin)
+				{
+					PinIndices.Add(Pin, NextPinIndex++);
+				}
+			}
+		}
+	}
+
+	FBlueprintRecord& BlueprintRecord = Blueprints.AddZeroed_GetRef();
+	BlueprintRecord.PackageName = AddString(Blueprint->GetOutermost()->GetName());
+	BlueprintRecord.BlueprintClass = AddString(Blueprint->GetClass()->GetName());
+	BlueprintRecord.ParentClass = Blueprint->ParentClass ? AddString(Blueprint->ParentClass->GetPathName()) : InvalidIndex;
+	BlueprintRecord.FirstGraph = Graphs.Num();
+	BlueprintRecord.NumGraphs = AllGraphs.Num();
+	BlueprintRecord.FirstVariable = Variables.Num();
+	BlueprintRecord.NumVariables = Blueprint->NewVariables.Num();
+
+	for(const UEdGraph* Graph : AllGraphs)
+	{
+		FGraphRecord& GraphRecord = Graphs.AddZeroed_GetRef();
+		GraphRecord.Name = AddString(Graph->GetName());
+		GraphRecord.Kind = GetGraphKind(Blueprint, Graph);
+		GraphRecord.FirstNode = Nodes.Num();
+
+		for(const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if(!Node) continue;
+
+			const uint32 NodeIndex = Nodes.Num();
+			FNodeRecord& NodeRecord = Nodes.AddZeroed_GetRef();
+			NodeRecord.Class = AddString(Node->GetClass()->GetName());
+			NodeRecord.Key = AddString(ValidatorX::GetCanonicalNodeKey(Node));
+			NodeRecord.MemberName = InvalidIndex;
+			NodeRecord.MemberParent = InvalidIndex;
+			NodeRecord.PosX = Node->NodePosX;
+			NodeRecord.PosY = Node->NodePosY;
+			NodeRecord.FirstPin = Pins.Num();
+			NodeRecord.Guid[0] = Node->NodeGuid.A;
+			NodeRecord.Guid[1] = Node->NodeGuid.B;
+			NodeRecord.Guid[2] = Node->NodeGuid.C;
+			NodeRecord.Guid[3] = Node->NodeGuid.D;
+
+			const FMemberReference* MemberReference = nullptr;
+			if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				MemberReference = &CallNode->FunctionReference;
+			}
+			else if(const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+			{
+				MemberReference = &VariableNode->VariableReference;
+			}
+			if(MemberReference)
+			{
+				NodeRecord.MemberName = AddString(MemberReference->GetMemberName().ToString());
+				if(const UClass* ParentClass = MemberReference->GetMemberParentClass())
+				{
+					NodeRecord.MemberParent = AddString(ParentClass->GetPathName());
+				}
+			}
+
+			NodeRecord.Flags |= ValidatorX::HasExecPins(Node) ? NodeFlag_HasExecPins : 0;
+			NodeRecord.Flags |= Node->IsA<UEdGraphNode_Comment>() ? NodeFlag_Comment : 0;
+			NodeRecord.Flags |= Node->IsA<UK2Node_Knot>() ? NodeFlag_Knot : 0;
+			NodeRecord.Flags |= !Node->IsNodeEnabled() ? NodeFlag_Disabled : 0;
+
+			for(const UEdGraphPin* Pin : Node->Pins)
+			{
+				if(!Pin) continue;
+
+				const FString DefaultValue = ValidatorX::Snapshot::GetPinDefaultValue(Pin);
+
+				FPinRecord& PinRecord = Pins.AddZeroed_GetRef();
+				PinRecord.Node = NodeIndex;
+				PinRecord.Name = AddString(Pin->PinName.ToString());
+				PinRecord.Category = AddString(Pin->PinType.PinCategory.ToString());
+				PinRecord.DefaultValue = DefaultValue.IsEmpty() ? InvalidIndex : AddString(DefaultValue);
+				PinRecord.FirstLink = Links.Num();
+				PinRecord.Direction = static_cast<uint8>(Pin->Direction);
+				PinRecord.Flags |= Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec ? PinFlag_Exec : 0;
+				PinRecord.Flags |= Pin->bHidden ? PinFlag_Hidden : 0;
+
+				for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					if(const uint32* TargetIndex = PinIndices.Find(LinkedPin))
+					{
+						Links.Add({ *TargetIndex });
+						PinRecord.NumLinks++;
+					}
+				}
+			}
+
+			Nodes[NodeIndex].NumPins = Pins.Num() - Nodes[NodeIndex].FirstPin;
+		}
+
+		Graphs.Last().NumNodes = Nodes.Num() - Graphs.Last().FirstNode;
+	}
+
+	for(const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		FVariableRecord& VariableRecord = Variables.AddZeroed_GetRef();
+		VariableRecord.Name = AddString(Variable.VarName.ToString());
+		VariableRecord.Category = AddString(Variable.VarType.PinCategory.ToString());
+		VariableRecord.SubCategoryObject = Variable.VarType.PinSubCategoryObject.IsValid()
+			? AddString(Variable.VarType.PinSubCategoryObject->GetPathName())
+			: InvalidIndex;
+		VariableRecord.ReplicationCondition = static_cast<uint32>(Variable.ReplicationCondition);
+		VariableRecord.PropertyFlags = Variable.PropertyFlags;
+	}
+}
+
+bool FValidatorXSnapshotWriter::Save(const FString& FilePath)
+{
+	using namespace ValidatorX::Snapshot;
+
+	if(StringOffsets.Num() == 0)
+	{
+		StringOffsets.Add(0);
+	}
+
+	const TPair<const void*, int64> SectionData[static_cast<uint32>(ESection::Count)] =
+	{
+		{ Blueprints.GetData(), Blueprints.Num() },
+		{ Graphs.GetData(), Graphs.Num() },
+		{ Nodes.GetData(), Nodes.Num() },
+		{ Pins.GetData(), Pins.Num() },
+		{ Links.GetData(), Links.Num() },
+		{ Variables.GetData(), Variables.Num() },
+		{ StringOffsets.GetData(), StringOffsets.Num() },
+		{ StringData.GetData(), StringData.Num() },
+	};
+
+	FHeader Header;
+	uint64 Offset = Align(sizeof(FHeader), SectionAlignment);
+	for(uint32 Section = 0; Section < static_cast<uint32>(ESection::Count); ++Section)
+	{
+		Header.Sections[Section].Offset = Offset;
+		Header.Sections[Section].Num = SectionData[Section].Value;
+		Offset = Align(Offset + SectionData[Section].Value * RecordSizes[Section], SectionAlignment);
+	}
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if(!Writer)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write snapshot shard '%s'"), *FilePath);
+		return false;
+	}
+
+	uint8 Padding[SectionAlignment] = {};
+	Writer->Serialize(&Header, sizeof(FHeader));
+	Writer->Serialize(Padding, Align(sizeof(FHeader), SectionAlignment) - sizeof(FHeader));
+	for(uint32 Section = 0; Section < static_cast<uint32>(ESection::Count); ++Section)
+	{
+		const int64 Bytes = SectionData[Section].Value * RecordSizes[Section];
+		Writer->Serialize(const_cast<void*>(SectionData[Section].Key), Bytes);
+		Writer->Serialize(Padding, Align(Bytes, SectionAlignment) - Bytes);
+	}
+
+	const bool bSuccess = Writer->Close();
+
+	Blueprints.Reset();
+	Graphs.Reset();
+	Nodes.Reset();
+	Pins.Reset();
+	Links.Reset();
+	Variables.Reset();
+	StringOffsets.Reset();
+	StringData.Reset();
+	StringIndices.Reset();
+
+	return bSuccess;
+}
+
+FValidatorXSnapshotReader::FValidatorXSnapshotReader()
+{
+}
+
+FValidatorXSnapshotReader::~FValidatorXSnapshotReader()
+{
+	// The region has to be released before its file handle
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+}
+
+bool FValidatorXSnapshotReader::Open(const FString& FilePath)
+{
+	using namespace ValidatorX::Snapshot;
+
+	MappedRegion.Reset();
+	MappedHandle.Reset();
+	FileData.Empty();
+	Data = nullptr;
+	DataSize = 0;
+	Header = nullptr;
+
+	MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if(MappedHandle && MappedHandle->GetFileSize() > 0)
+	{
+		MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+	}
+
+	if(MappedRegion)
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+	else if(FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		Data = FileData.GetData();
+		DataSize = FileData.Num();
+	}
+	else
+	{
+		return false;
+	}
+
+	if(DataSize < static_cast<int64>(sizeof(FHeader)))
+	{
+		return false;
+	}
+
+	const FHeader* CandidateHeader = reinterpret_cast<const FHeader*>(Data);
+	if(CandidateHeader->Magic != Magic || CandidateHeader->Version != Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("'%s' is not a ValidatorX snapshot shard of version %u"), *FilePath, Version);
+		return false;
+	}
+
+	for(uint32 Section = 0; Section < static_cast<uint32>(ESection::Count); ++Section)
+	{
+		const FSection& Entry = CandidateHeader->Sections[Section];
+		if(Entry.Offset % SectionAlignment != 0 || Entry.Num > MAX_int32 || Entry.Offset + Entry.Num * RecordSizes[Section] > static_cast<uint64>(DataSize))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Snapshot shard '%s' is truncated or corrupt"), *FilePath);
+			return false;
+		}
+	}
+
+	Header = CandidateHeader;
+	return true;
+}
+
+FUtf8StringView FValidatorXSnapshotReader::GetString(uint32 Index) const
+{
+	using namespace ValidatorX::Snapshot;
+
+	const TConstArrayView<uint32> Offsets = GetSection<uint32>(ESection::StringOffsets);
+	if(Index == InvalidIndex || static_cast<int64>(Index) + 1 >= Offsets.Num())
+	{
+		return FUtf8StringView();
+	}
+
+	const FSection& StringDataSection = Header->Sections[static_cast<uint32>(ESection::StringData)];
+	if(Offsets[Index] > Offsets[Index + 1] || Offsets[Index + 1] > StringDataSection.Num)
+	{
+		return FUtf8StringView();
+	}
+
+	const uint64 StringDataOffset = StringDataSection.Offset;
+	const UTF8CHAR* Start = reinterpret_cast<const UTF8CHAR*>(Data + StringDataOffset + Offsets[Index]);
+	return FUtf8StringView(Start, Offsets[Index + 1] - Offsets[Index]);
+}
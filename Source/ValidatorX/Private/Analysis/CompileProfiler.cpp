@@ -0,0 +1,225 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/CompileProfiler.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "K2Node_Knot.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace ValidatorX
+{
+	const TCHAR* CompileHistoryHeader = TEXT("Timestamp,Package,CompileMs,Succeeded,Graphs,Nodes,MaxGraphNodes,MacroInstances");
+
+	double PearsonCorrelation(TConstArrayView<double> X, TConstArrayView<double> Y)
+	{
+		const int32 Num = X.Num();
+		if(Num < 2)
+		{
+			return 0.0;
+		}
+
+		double MeanX = 0.0;
+		double MeanY = 0.0;
+		for(int32 Index = 0; Index < Num; ++Index)
+		{
+			MeanX += X[Index];
+			MeanY += Y[Index];
+		}
+		MeanX /= Num;
+		MeanY /= Num;
+
+		double Covariance = 0.0;
+		double VarianceX = 0.0;
+		double VarianceY = 0.0;
+		for(int32 Index = 0; Index < Num; ++Index)
+		{
+			const double DX = X[Index] - MeanX;
+			const double DY = Y[Index] - MeanY;
+			Covariance += DX * DY;
+			VarianceX += DX * DX;
+			VarianceY += DY * DY;
+		}
+
+		const double Denominator = FMath::Sqrt(VarianceX * VarianceY);
+		return Denominator > UE_DOUBLE_SMALL_NUMBER ? Covariance / Denominator : 0.0;
+	}
+}
+
+FString FValidatorXCompileProfiler::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ValidatorX") / TEXT("CompileHistory.csv");
+}
+
+FValidatorXCompileSample FValidatorXCompileProfiler::ProfileBlueprint(UBlueprint* Blueprint)
+{
+	FValidatorXCompileSample Sample;
+	if(!Blueprint)
+	{
+		return Sample;
+	}
+
+	if(!bLoaded)
+	{
+		Load();
+	}
+
+	Sample.PackageName = Blueprint->GetOutermost()->GetFName();
+	Sample.Timestamp = FDateTime::UtcNow().ToUnixTimestamp();
+	Sample.Metrics = ValidatorX::GatherBlueprintMetrics(Blueprint);
+
+	FCompilerResultsLog Results;
+	Results.bSilentMode = true;
+
+	const double StartTime = FPlatformTime::Seconds();
+	FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection | EBlueprintCompileOptions::SkipSave, &Results);
+	Sample.CompileMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	Sample.bSucceeded = Results.NumErrors == 0;
+
+	if(Sample.Metrics.NumNodes > 0)
+	{
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint->GetAllGraphs(AllGraphs);
+		for(const UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			const int32 GraphNodes = Graph->Nodes.FilterByPredicate([] (const UEdGraphNode* Node)
+				{
+					return Node && !Node->IsA<UEdGraphNode_Comment>() && !Node->IsA<UK2Node_Knot>();
+				}).Num();
+			if(GraphNodes > 0)
+			{
+				Sample.EstimatedGraphMs.Emplace(Graph->GetFName(), Sample.CompileMs * GraphNodes / Sample.Metrics.NumNodes);
+			}
+		}
+		Sample.EstimatedGraphMs.Sort([] (const TPair<FName, double>& A, const TPair<FName, double>& B) { return A.Value > B.Value; });
+	}
+
+	Record(Sample);
+	PendingSamples.Add(Sample);
+	return Sample;
+}
+
+void FValidatorXCompileProfiler::Record(const FValidatorXCompileSample& Sample)
+{
+	FHistory* History = Histories.Find(Sample.PackageName);
+	if(!History)
+	{
+		Histories.Add(Sample.PackageName, { Sample, {} });
+		return;
+	}
+
+	History->Previous = MoveTemp(History->Latest);
+	History->Latest = Sample;
+}
+
+const FValidatorXCompileSample* FValidatorXCompileProfiler::FindLatest(FName PackageName) const
+{
+	const FHistory* History = Histories.Find(PackageName);
+	return History ? &History->Latest : nullptr;
+}
+
+const FValidatorXCompileSample* FValidatorXCompileProfiler::FindPrevious(FName PackageName) const
+{
+	const FHistory* History = Histories.Find(PackageName);
+	return History && History->Previous.IsSet() ? &History->Previous.GetValue() : nullptr;
+}
+
+void FValidatorXCompileProfiler::Load()
+{
+	bLoaded = true;
+	Histories.Reset();
+
+	TArray<FString> Lines;
+	if(!FFileHelper::LoadFileToStringArray(Lines, *GetFilePath()))
+	{
+		return;
+	}
+
+	// The file is in chronological order, so replaying it leaves the latest two samples per package
+	TArray<FString> Columns;
+	for(const FString& Line : Lines)
+	{
+		Columns.Reset();
+		Line.ParseIntoArray(Columns, TEXT(","), false);
+		if(Columns.Num() != 8 || !Columns[0].IsNumeric())
+		{
+			continue;
+		}
+
+		FValidatorXCompileSample Sample;
+		LexFromString(Sample.Timestamp, *Columns[0]);
+		Sample.PackageName = FName(*Columns[1]);
+		LexFromString(Sample.CompileMs, *Columns[2]);
+		Sample.bSucceeded = Columns[3] == TEXT("1");
+		LexFromString(Sample.Metrics.NumGraphs, *Columns[4]);
+		LexFromString(Sample.Metrics.NumNodes, *Columns[5]);
+		LexFromString(Sample.Metrics.MaxGraphNodes, *Columns[6]);
+		LexFromString(Sample.Metrics.NumMacroInstances, *Columns[7]);
+		Record(Sample);
+	}
+}
+
+void FValidatorXCompileProfiler::Flush()
+{
+	if(PendingSamples.Num() == 0)
+	{
+		return;
+	}
+
+	const FString FilePath = GetFilePath();
+	FString Text;
+	if(!FPaths::FileExists(FilePath))
+	{
+		Text = FString(ValidatorX::CompileHistoryHeader) + LINE_TERMINATOR;
+	}
+
+	for(const FValidatorXCompileSample& Sample : PendingSamples)
+	{
+		Text += FString::Printf(TEXT("%lld,%s,%.2f,%d,%d,%d,%d,%d") LINE_TERMINATOR,
+			Sample.Timestamp,
+			*Sample.PackageName.ToString(),
+			Sample.CompileMs,
+			Sample.bSucceeded ? 1 : 0,
+			Sample.Metrics.NumGraphs,
+			Sample.Metrics.NumNodes,
+			Sample.Metrics.MaxGraphNodes,
+			Sample.Metrics.NumMacroInstances);
+	}
+
+	if(FFileHelper::SaveStringToFile(Text, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		PendingSamples.Reset();
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not append to compile history '%s'"), *FilePath);
+	}
+}
+
+FString FValidatorXCompileProfiler::DescribeCorrelations(TConstArrayView<FValidatorXCompileSample> Samples)
+{
+	TArray<double> CompileMs;
+	TArray<double> Nodes;
+	TArray<double> Macros;
+	TArray<double> Graphs;
+	for(const FValidatorXCompileSample& Sample : Samples)
+	{
+		CompileMs.Add(Sample.CompileMs);
+		Nodes.Add(Sample.Metrics.NumNodes);
+		Macros.Add(Sample.Metrics.NumMacroInstances);
+		Graphs.Add(Sample.Metrics.NumGraphs);
+	}
+
+	return FString::Printf(TEXT("nodes r=%.2f, macro instances r=%.2f, graphs r=%.2f"),
+		ValidatorX::PearsonCorrelation(CompileMs, Nodes),
+		ValidatorX::PearsonCorrelation(CompileMs, Macros),
+		ValidatorX::PearsonCorrelation(CompileMs, Graphs));
+}
@@ -0,0 +1,145 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/DependencySizeCache.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/AssetData.h"
+#include "Misc/PackageName.h"
+
+int64 FValidatorXDependencyCache::GetPackageSize(FName PackageName)
+{
+	return Packages[FindOrAddPackage(PackageName)].DiskSize;
+}
+
+int32 FValidatorXDependencyCache::GetDirectDependencyCount(FName PackageName)
+{
+	const int32 Index = FindOrAddPackage(PackageName);
+	GatherDependencies(Index);
+	return Packages[Index].Dependencies.Num();
+}
+
+FValidatorXDependencyCache::FClosureInfo FValidatorXDependencyCache::GetClosure(FName PackageName)
+{
+	const int32 Index = FindOrAddPackage(PackageName);
+	if(!Packages[Index].bClosureComputed)
+	{
+		ComputeClosure(Index);
+	}
+	return Packages[Index].Summary;
+}
+
+void FValidatorXDependencyCache::Reset()
+{
+	Packages.Reset();
+	PackageIndices.Reset();
+	VisitStamps.Reset();
+	CurrentStamp = 0;
+}
+
+int32 FValidatorXDependencyCache::FindOrAddPackage(FName PackageName)
+{
+	if(const int32* ExistingIndex = PackageIndices.Find(PackageName))
+	{
+		return *ExistingIndex;
+	}
+
+	const int32 Index = Packages.AddDefaulted();
+	PackageIndices.Add(PackageName, Index);
+	VisitStamps.Add(0);
+
+	FPackageEntry& Entry = Packages[Index];
+	Entry.PackageName = PackageName;
+
+	if(TOptional<FAssetPackageData> PackageData = IAssetRegistry::GetChecked().GetAssetPackageDataCopy(PackageName))
+	{
+		Entry.DiskSize = FMath::Max<int64>(PackageData->DiskSize, 0);
+	}
+
+	return Index;
+}
+
+void FValidatorXDependencyCache::GatherDependencies(int32 Index)
+{
+	if(Packages[Index].bDependenciesGathered)
+	{
+		return;
+	}
+
+	const FName PackageName = Packages[Index].PackageName;
+
+	TArray<FName> DependencyNames;
+	IAssetRegistry::GetChecked().GetDependencies(PackageName, DependencyNames, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+	// Only intern the names here, dependencies of dependencies are fetched when they are first visited
+	TArray<int32> DependencyIndices;
+	DependencyIndices.Reserve(DependencyNames.Num());
+	for(const FName& DependencyName : DependencyNames)
+	{
+		if(DependencyName == PackageName || FPackageName::IsScriptPackage(DependencyName.ToString()))
+		{
+			continue;
+		}
+
+		DependencyIndices.Add(FindOrAddPackage(DependencyName));
+	}
+
+	Packages[Index].Dependencies = MoveTemp(DependencyIndices);
+	Packages[Index].bDependenciesGathered = true;
+}
+
+void FValidatorXDependencyCache::ComputeClosure(int32 RootIndex)
+{
+	if(++CurrentStamp == 0)
+	{
+		FMemory::Memzero(VisitStamps.GetData(), VisitStamps.Num() * sizeof(uint32));
+		CurrentStamp = 1;
+	}
+
+	TArray<int32> Closure;
+	TArray<int32> Stack;
+	Stack.Push(RootIndex);
+	VisitStamps[RootIndex] = CurrentStamp;
+
+	while(Stack.Num() > 0)
+	{
+		const int32 Index = Stack.Pop();
+		Closure.Add(Index);
+
+		// Already solved sub-closures are merged as a whole instead of being walked again
+		if(Index != RootIndex && Packages[Index].bClosureComputed)
+		{
+			for(const int32 Member : Packages[Index].Closure)
+			{
+				if(VisitStamps[Member] != CurrentStamp)
+				{
+					VisitStamps[Member] = CurrentStamp;
+					Closure.Add(Member);
+				}
+			}
+			continue;
+		}
+
+		GatherDependencies(Index);
+		for(int32 DependencyIndex = 0; DependencyIndex < Packages[Index].Dependencies.Num(); ++DependencyIndex)
+		{
+			const int32 Dependency = Packages[Index].Dependencies[DependencyIndex];
+			if(VisitStamps[Dependency] != CurrentStamp)
+			{
+				VisitStamps[Dependency] = CurrentStamp;
+				Stack.Push(Dependency);
+			}
+		}
+	}
+
+	FClosureInfo Summary;
+	for(const int32 Member : Closure)
+	{
+		Summary.TotalBytes += Packages[Member].DiskSize;
+	}
+	Summary.PackageCount = Closure.Num();
+
+	FPackageEntry& RootEntry = Packages[RootIndex];
+	RootEntry.Closure = MoveTemp(Closure);
+	RootEntry.Summary = Summary;
+	RootEntry.bClosureComputed = true;
+}
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/ExecControlFlowGraph.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+
+void FValidatorXExecGraph::Build(const UEdGraph* Graph)
+{
+	Nodes.Reset();
+	Successors.Reset();
+	Predecessors.Reset();
+	NodeIndices.Reset();
+
+	Nodes.Add(nullptr);
+	Successors.AddDefaulted();
+	Predecessors.AddDefaulted();
+
+	if(!Graph)
+	{
+		return;
+	}
+
+	TMap<FName, int32> CustomEvents;
+	for(UEdGraphNode* Node : Graph->Nodes)
+	{
+		if(!ValidatorX::HasExecPins(Node)) continue;
+
+		const int32 Index = Nodes.Add(Node);
+		Successors.AddDefaulted();
+		Predecessors.AddDefaulted();
+		NodeIndices.Add(Node, Index);
+
+		if(const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node))
+		{
+			CustomEvents.Add(CustomEvent->CustomFunctionName, Index);
+		}
+	}
+
+	for(int32 Index = 1; Index < Nodes.Num(); ++Index)
+	{
+		const UEdGraphNode* Node = Nodes[Index];
+		bool bHasLinkedExecInput = false;
+
+		for(const UEdGraphPin* Pin : Node->Pins)
+		{
+			if(!Pin || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec) continue;
+
+			if(Pin->Direction == EGPD_Input)
+			{
+				bHasLinkedExecInput |= Pin->LinkedTo.Num() > 0;
+				continue;
+			}
+
+			for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32 TargetIndex = LinkedPin ? FindIndex(LinkedPin->GetOwningNode()) : INDEX_NONE;
+				if(TargetIndex != INDEX_NONE)
+				{
+					AddEdge(Index, TargetIndex);
+				}
+			}
+		}
+
+		if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			if(CallNode->FunctionReference.IsSelfContext())
+			{
+				if(const int32* EventIndex = CustomEvents.Find(CallNode->FunctionReference.GetMemberName()))
+				{
+					AddEdge(Index, *EventIndex);
+				}
+			}
+		}
+
+		if(!bHasLinkedExecInput)
+		{
+			AddEdge(RootIndex, Index);
+		}
+	}
+}
+
+int32 FValidatorXExecGraph::FindIndex(const UEdGraphNode* Node) const
+{
+	const int32* Index = NodeIndices.Find(Node);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FValidatorXExecGraph::AddEdge(int32 From, int32 To)
+{
+	if(!Successors[From].Contains(To))
+	{
+		Successors[From].Add(To);
+		Predecessors[To].Add(From);
+	}
+}
+
+void FValidatorXExecGraph::ComputeDominators(TArray<int32>& OutImmediateDominators) const
+{
+	const int32 NumNodes = Nodes.Num();
+
+	// Iterative DFS to get a post order numbering from the root
+	TArray<int32> PostOrder;
+	PostOrder.Reserve(NumNodes);
+	TArray<int32> PostNumbers;
+	PostNumbers.Init(INDEX_NONE, NumNodes);
+	TBitArray<> Visited(false, NumNodes);
+
+	TArray<TPair<int32, int32>> Stack;
+	Stack.Emplace(RootIndex, 0);
+	Visited[RootIndex] = true;
+	while(Stack.Num() > 0)
+	{
+		const int32 Current = Stack.Last().Key;
+		const int32 NextSuccessor = Stack.Last().Value;
+		if(NextSuccessor < Successors[Current].Num())
+		{
+			Stack.Last().Value++;
+			const int32 Successor = Successors[Current][NextSuccessor];
+			if(!Visited[Successor])
+			{
+				Visited[Successor] = true;
+				Stack.Emplace(Successor, 0);
+			}
+		}
+		else
+		{
+			PostNumbers[Current] = PostOrder.Add(Current);
+			Stack.Pop();
+		}
+	}
+
+	OutImmediateDominators.Init(INDEX_NONE, NumNodes);
+	OutImmediateDominators[RootIndex] = RootIndex;
+
+	auto Intersect = [&PostNumbers, &OutImmediateDominators] (int32 A, int32 B)
+		{
+			while(A != B)
+			{
+				while(PostNumbers[A] < PostNumbers[B])
+				{
+					A = OutImmediateDominators[A];
+				}
+				while(PostNumbers[B] < PostNumbers[A])
+				{
+					B = OutImmediateDominators[B];
+				}
+			}
+			return A;
+		};
+
+	bool bChanged = true;
+	while(bChanged)
+	{
+		bChanged = false;
+
+		// Reverse post order, skipping the root which is last in post order
+		for(int32 OrderIndex = PostOrder.Num() - 2; OrderIndex >= 0; --OrderIndex)
+		{
+			const int32 Node = PostOrder[OrderIndex];
+
+			int32 NewDominator = INDEX_NONE;
+			for(const int32 Predecessor : Predecessors[Node])
+			{
+				if(OutImmediateDominators[Predecessor] == INDEX_NONE)
+				{
+					continue;
+				}
+				NewDominator = NewDominator == INDEX_NONE ? Predecessor : Intersect(Predecessor, NewDominator);
+			}
+
+			if(NewDominator != OutImmediateDominators[Node])
+			{
+				OutImmediateDominators[Node] = NewDominator;
+				bChanged = true;
+			}
+		}
+	}
+}
+
+void FValidatorXExecGraph::CollectNaturalLoop(int32 Header, int32 Latch, TArray<int32>& OutBody) const
+{
+	TBitArray<> InBody(false, Nodes.Num());
+	InBody[Header] = true;
+	OutBody.Add(Header);
+
+	TArray<int32> Stack;
+	if(!InBody[Latch])
+	{
+		InBody[Latch] = true;
+		OutBody.Add(Latch);
+		Stack.Push(Latch);
+	}
+
+	while(Stack.Num() > 0)
+	{
+		const int32 Node = Stack.Pop();
+		for(const int32 Predecessor : Predecessors[Node])
+		{
+			if(Predecessor != RootIndex && !InBody[Predecessor])
+			{
+				InBody[Predecessor] = true;
+				OutBody.Add(Predecessor);
+				Stack.Push(Predecessor);
+			}
+		}
+	}
+}
@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/SubgraphHashTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "Serialization/NameAsStringProxyArchive.h"
+#include "ValidatorXStateFiles.h"
+
+namespace ValidatorX
+{
+	// 2: hashes taken over UTF-8 strings and culture invariant text
+	constexpr int32 SubgraphHashTableVersion = 2;
+}
+
+void FValidatorXSubgraphHashTable::ReplacePackage(FName PackageName, TArray<FClusterRecord>&& Records)
+{
+	if(TArray<FClusterRecord>* Existing = PackageRecords.Find(PackageName))
+	{
+		RemoveFromIndex(PackageName, *Existing);
+		PackageRecords.Remove(PackageName);
+	}
+
+	if(Records.Num() > 0)
+	{
+		AddToIndex(PackageName, Records);
+		PackageRecords.Add(PackageName, MoveTemp(Records));
+	}
+
+	bDirty = true;
+}
+
+const FValidatorXSubgraphHashTable::FLocation* FValidatorXSubgraphHashTable::FindInOtherPackage(uint64 Hash, FName PackageName, int32& OutPackageCount) const
+{
+	OutPackageCount = 0;
+
+	const FHashEntry* Entry = HashIndex.Find(Hash);
+	if(!Entry)
+	{
+		return nullptr;
+	}
+
+	OutPackageCount = Entry->PackageCount;
+	for(const FLocation& Location : Entry->Locations)
+	{
+		if(Location.PackageName != PackageName)
+		{
+			return &Location;
+		}
+	}
+	return nullptr;
+}
+
+void FValidatorXSubgraphHashTable::AddToIndex(FName PackageName, const TArray<FClusterRecord>& Records)
+{
+	TSet<uint64> SeenHashes;
+	SeenHashes.Reserve(Records.Num());
+
+	for(const FClusterRecord& Record : Records)
+	{
+		bool bAlreadySeen = false;
+		SeenHashes.Add(Record.Hash, &bAlreadySeen);
+		if(bAlreadySeen) continue;
+
+		FHashEntry& Entry = HashIndex.FindOrAdd(Record.Hash);
+		Entry.PackageCount++;
+		if(Entry.Locations.Num() < 2)
+		{
+			Entry.Locations.Add({ PackageName, Record.GraphName, Record.NodeGuid });
+		}
+	}
+}
+
+void FValidatorXSubgraphHashTable::RemoveFromIndex(FName PackageName, const TArray<FClusterRecord>& Records)
+{
+	TSet<uint64> SeenHashes;
+	SeenHashes.Reserve(Records.Num());
+
+	for(const FClusterRecord& Record : Records)
+	{
+		bool bAlreadySeen = false;
+		SeenHashes.Add(Record.Hash, &bAlreadySeen);
+		if(bAlreadySeen) continue;
+
+		FHashEntry* Entry = HashIndex.Find(Record.Hash);
+		if(!Entry) continue;
+
+		Entry->Locations.RemoveAll([PackageName] (const FLocation& Location) { return Location.PackageName == PackageName; });
+		if(--Entry->PackageCount <= 0)
+		{
+			HashIndex.Remove(Record.Hash);
+		}
+	}
+}
+
+FString FValidatorXSubgraphHashTable::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ValidatorX") / TEXT("SubgraphHashes.bin");
+}
+
+void FValidatorXSubgraphHashTable::Load()
+{
+	Reset();
+
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*GetFilePath()));
+	if(!FileReader)
+	{
+		return;
+	}
+
+	// Plain file archives drop FNames, store them as strings
+	FNameAsStringProxyArchive Reader(*FileReader);
+
+	int32 Version = 0;
+	int32 NumRecordedPackages = 0;
+	Reader << Version;
+	if(Version != ValidatorX::SubgraphHashTableVersion)
+	{
+		return;
+	}
+
+	Reader << NumRecordedPackages;
+	PackageRecords.Reserve(NumRecordedPackages);
+	for(int32 Index = 0; Index < NumRecordedPackages && !Reader.IsError(); ++Index)
+	{
+		FName PackageName;
+		TArray<FClusterRecord> Records;
+		Reader << PackageName << Records;
+
+		AddToIndex(PackageName, Records);
+		PackageRecords.Add(PackageName, MoveTemp(Records));
+	}
+
+	if(Reader.IsError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Subgraph hash table '%s' is corrupt and was ignored"), *GetFilePath());
+		Reset();
+	}
+}
+
+void FValidatorXSubgraphHashTable::Save()
+{
+	if(!bDirty || !ValidatorX::IsPersistingState())
+	{
+		return;
+	}
+
+	const bool bSaved = ValidatorX::SaveArchiveAtomically(GetFilePath(), [this] (FArchive& FileWriter)
+		{
+			FNameAsStringProxyArchive Writer(FileWriter);
+
+			int32 Version = ValidatorX::SubgraphHashTableVersion;
+			int32 NumRecordedPackages = PackageRecords.Num();
+			Writer << Version << NumRecordedPackages;
+			for(TPair<FName, TArray<FClusterRecord>>& Pair : PackageRecords)
+			{
+				Writer << Pair.Key << Pair.Value;
+			}
+		});
+
+	if(!bSaved)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write subgraph hash table '%s'"), *GetFilePath());
+		return;
+	}
+	bDirty = false;
+}
+
+void FValidatorXSubgraphHashTable::Reset()
+{
+	PackageRecords.Reset();
+	HashIndex.Reset();
+	bDirty = false;
+}
@@ -0,0 +1,229 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Analysis/SubgraphHasher.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "Hash/CityHash.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_Event.h"
+#include "K2Node_Knot.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_Variable.h"
+
+namespace ValidatorX
+{
+	/** Stands in for a node that is already being hashed further up the stack (data cycles through knots) */
+	constexpr uint64 CycleSentinelHash = 0x9E3779B97F4A7C15ull;
+
+	uint64 HashStableString(const FString& Value)
+	{
+		// UTF-8 rather than the raw TCHARs, whose width and encoding depend on the platform
+		const FTCHARToUTF8 Utf8(*Value, Value.Len());
+		return CityHash64(Utf8.Get(), Utf8.Length());
+	}
+
+	uint64 CombineStableHash(uint64 A, uint64 B)
+	{
+		return CityHash128to64(Uint128_64(A, B));
+	}
+
+	FString GetCanonicalNodeKey(const UEdGraphNode* Node)
+	{
+		FString Key = Node->GetClass()->GetName();
+
+		if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			const UClass* ParentClass = CallNode->FunctionReference.GetMemberParentClass();
+			Key += FString::Printf(TEXT("|%s.%s"), ParentClass ? *ParentClass->GetName() : TEXT("Self"), *CallNode->FunctionReference.GetMemberName().ToString());
+		}
+		else if(const UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+		{
+			Key += TEXT("|") + VariableNode->GetVarName().ToString();
+		}
+		else if(const UK2Node_MacroInstance* MacroNode = Cast<UK2Node_MacroInstance>(Node))
+		{
+			const UEdGraph* MacroGraph = MacroNode->GetMacroGraph();
+			Key += TEXT("|") + (MacroGraph ? MacroGraph->GetName() : FString());
+		}
+		else if(const UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+		{
+			Key += TEXT("|") + EventNode->GetFunctionName().ToString();
+		}
+		else if(const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(Node))
+		{
+			Key += TEXT("|") + (CastNode->TargetType ? CastNode->TargetType->GetName() : FString());
+		}
+
+		return Key;
+	}
+}
+
+FValidatorXSubgraphHasher::FNodeHashes FValidatorXSubgraphHasher::GetDataHashes(const UEdGraphNode* Node)
+{
+	if(const FNodeHashes* Existing = DataHashes.Find(Node))
+	{
+		if(Existing->bInProgress)
+		{
+			FNodeHashes Sentinel;
+			Sentinel.Hash = ValidatorX::CycleSentinelHash;
+			Sentinel.StructureHash = ValidatorX::CycleSentinelHash;
+			return Sentinel;
+		}
+		return *Existing;
+	}
+
+	DataHashes.Add(Node).bInProgress = true;
+
+	FNodeHashes Result;
+	Result.Hash = ValidatorX::HashStableString(ValidatorX::GetCanonicalNodeKey(Node));
+	Result.StructureHash = Result.Hash;
+	Result.Size = Node->IsA<UK2Node_Knot>() ? 0 : 1;
+
+	for(const UEdGraphPin* Pin : Node->Pins)
+	{
+		if(!Pin || Pin->Direction != EGPD_Input || Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+		{
+			continue;
+		}
+
+		const uint64 PinNameHash = ValidatorX::HashStableString(Pin->PinName.ToString());
+
+		if(Pin->LinkedTo.Num() == 0)
+		{
+			FString DefaultValue = Pin->DefaultValue;
+			if(Pin->DefaultObject)
+			{
+				DefaultValue += Pin->DefaultObject->GetPathName();
+			}
+			if(!Pin->DefaultTextValue.IsEmpty())
+			{
+				// Source string, the display string depends on the editor culture
+				DefaultValue += Pin->DefaultTextValue.BuildSourceString();
+			}
+
+			Result.Hash = ValidatorX::CombineStableHash(Result.Hash, ValidatorX::CombineStableHash(PinNameHash, ValidatorX::HashStableString(DefaultValue)));
+			Result.StructureHash = ValidatorX::CombineStableHash(Result.StructureHash, PinNameHash);
+			continue;
+		}
+
+		for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+		{
+			const UEdGraphNode* Producer = LinkedPin->GetOwningNode();
+			const uint64 SourcePinHash = ValidatorX::CombineStableHash(PinNameHash, ValidatorX::HashStableString(LinkedPin->PinName.ToString()));
+
+			uint64 ProducerHash = 0;
+			uint64 ProducerStructureHash = 0;
+			if(ValidatorX::HasExecPins(Producer))
+			{
+				// Values from exec nodes are referenced by identity only, their own cluster hashes them in full
+				ProducerHash = ValidatorX::HashStableString(ValidatorX::GetCanonicalNodeKey(Producer));
+				ProducerStructureHash = ProducerHash;
+			}
+			else
+			{
+				const FNodeHashes ProducerHashes = GetDataHashes(Producer);
+				ProducerHash = ProducerHashes.Hash;
+				ProducerStructureHash = ProducerHashes.StructureHash;
+				Result.Size += ProducerHashes.Size;
+			}
+
+			Result.Hash = ValidatorX::CombineStableHash(Result.Hash, ValidatorX::CombineStableHash(SourcePinHash, ProducerHash));
+			Result.StructureHash = ValidatorX::CombineStableHash(Result.StructureHash, ValidatorX::CombineStableHash(SourcePinHash, ProducerStructureHash));
+		}
+	}
+
+	Result.bDone = true;
+	DataHashes[Node] = Result;
+	return Result;
+}
+
+FValidatorXSubgraphHasher::FNodeHashes FValidatorXSubgraphHasher::GetChainHashes(const UEdGraphNode* Node, int32 RemainingSteps)
+{
+	const TPair<const UEdGraphNode*, int32> Key(Node, RemainingSteps);
+	if(const FNodeHashes* Existing = ChainHashes.Find(Key))
+	{
+		return *Existing;
+	}
+
+	FNodeHashes Result = GetDataHashes(Node);
+
+	if(RemainingSteps > 1)
+	{
+		for(const UEdGraphPin* Pin : Node->Pins)
+		{
+			if(!Pin || Pin->Direction != EGPD_Output || Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+			{
+				continue;
+			}
+
+			const uint64 PinNameHash = ValidatorX::HashStableString(Pin->PinName.ToString());
+			for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const FNodeHashes Next = GetChainHashes(LinkedPin->GetOwningNode(), RemainingSteps - 1);
+				Result.Hash = ValidatorX::CombineStableHash(Result.Hash, ValidatorX::CombineStableHash(PinNameHash, Next.Hash));
+				Result.StructureHash = ValidatorX::CombineStableHash(Result.StructureHash, ValidatorX::CombineStableHash(PinNameHash, Next.StructureHash));
+				Result.Size += Next.Size;
+			}
+		}
+	}
+
+	ChainHashes.Add(Key, Result);
+	return Result;
+}
+
+void FValidatorXSubgraphHasher::CollectClusters(const UEdGraph* Graph, int32 MinSize, TArray<FCluster>& OutClusters)
+{
+	DataHashes.Reset();
+	ChainHashes.Reset();
+
+	if(!Graph)
+	{
+		return;
+	}
+
+	for(UEdGraphNode* Node : Graph->Nodes)
+	{
+		if(!Node || Node->IsA<UEdGraphNode_Comment>()) continue;
+
+		FNodeHashes Hashes;
+		if(ValidatorX::HasExecPins(Node))
+		{
+			Hashes = GetChainHashes(Node, ChainLength);
+		}
+		else
+		{
+			// Only the root of a pure expression tree forms a cluster, its inner nodes are part of it
+			bool bHasConsumer = false;
+			bool bFeedsOnlyExecNodes = true;
+			for(const UEdGraphPin* Pin : Node->Pins)
+			{
+				if(!Pin || Pin->Direction != EGPD_Output) continue;
+
+				for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					bHasConsumer = true;
+					bFeedsOnlyExecNodes &= ValidatorX::HasExecPins(LinkedPin->GetOwningNode());
+				}
+			}
+
+			if(!bHasConsumer || !bFeedsOnlyExecNodes)
+			{
+				continue;
+			}
+			Hashes = GetDataHashes(Node);
+		}
+
+		if(Hashes.Size >= MinSize)
+		{
+			FCluster& Cluster = OutClusters.AddDefaulted_GetRef();
+			Cluster.RootNode = Node;
+			Cluster.Hash = Hashes.Hash;
+			Cluster.StructureHash = Hashes.StructureHash;
+			Cluster.Size = Hashes.Size;
+		}
+	}
+}
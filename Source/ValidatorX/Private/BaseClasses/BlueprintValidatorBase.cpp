@@ -2,6 +2,161 @@
 
 
 #include "BaseClasses/BlueprintValidatorBase.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Misc/DataValidation.h"
+#include "Reporting/IssueFilter.h"
+#include "Reporting/IssueLog.h"
+#include "Reporting/ReportWriter.h"
+#include "Reporting/ValidatorSchedule.h"
+#include "ValidatorXConfigManager.h"
 
+FText UBlueprintValidatorBase::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(INVTEXT("{0} in '{1}'"), FText::FromName(Issue.RuleId), Issue.GetAssetText());
+}
 
+void UBlueprintValidatorBase::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+}
 
+bool UBlueprintValidatorBase::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return InAssetData.IsInstanceOf(UBlueprint::StaticClass());
+}
+
+void UBlueprintValidatorBase::ToggleValidationEnabled()
+{
+	SetValidationEnabled(!IsEnabled());
+}
+
+void UBlueprintValidatorBase::SetValidationEnabled(bool bEnabled)
+{
+	// Objects under construction have not read the config yet, writing the default object would undo the user's choice
+	if(bIsConfigDisabled || HasAnyFlags(RF_NeedInitialization))
+	{
+		return;
+	}
+
+	GetMutableDefault<UBlueprintValidatorBase>(GetClass())->bIsEnabled = bEnabled;
+	SaveEnabledConfig(bEnabled);
+}
+
+bool UBlueprintValidatorBase::IsEnabled() const
+{
+	return GetDefault<UBlueprintValidatorBase>(GetClass())->bIsEnabled && !bIsConfigDisabled;
+}
+
+void UBlueprintValidatorBase::SaveEnabledConfig(bool bEnabled) const
+{
+	FValidatorXConfigManager::Get().WriteEnabled(GetClass(), bEnabled);
+}
+
+bool UBlueprintValidatorBase::PassesFailFast(const FDataValidationContext& Context) const
+{
+	const FValidatorXValidatorSchedule& Schedule = FValidatorXValidatorSchedule::Get();
+	return !Schedule.IsFailFastEnabled()
+		|| Context.GetValidationUsecase() != EDataValidationUsecase::Save
+		|| Context.GetNumErrors() == 0
+		|| !Schedule.IsExpensive(this);
+}
+
+EDataValidationResult UBlueprintValidatorBase::RunValidation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	if(bIsConfigDisabled || !CanValidateAssetData(InAssetData) || !CanValidateAsset(InAssetData, InAsset, Context))
+	{
+		return EDataValidationResult::NotValidated;
+	}
+	return ValidateLoadedAsset(InAssetData, InAsset, Context);
+}
+
+FValidatorXValidationScope UBlueprintValidatorBase::BeginIssues(const UObject* Asset)
+{
+	bIsError = false;
+	bAddedDeferredSummary = false;
+
+	if(Asset)
+	{
+		FValidatorXIssueLog::Get().BeginAsset(GetClass(), Asset->GetOutermost()->GetFName());
+	}
+	return FValidatorXValidationScope(GetClass());
+}
+
+FValidatorXIssue UBlueprintValidatorBase::MakeIssue(FName RuleId, EMessageSeverity::Type Severity, const UObject* Asset, const UEdGraphNode* Node, FName MemberName) const
+{
+	FValidatorXIssue Issue;
+	Issue.RuleId = RuleId;
+	Issue.Severity = Severity;
+	Issue.Validator = GetClass();
+	Issue.MemberName = MemberName;
+
+	if(Asset)
+	{
+		Issue.PackageName = Asset->GetOutermost()->GetFName();
+		Issue.AssetName = Asset->GetFName();
+	}
+
+	if(Node)
+	{
+		Issue.NodeGuid = Node->NodeGuid;
+		Issue.Node = const_cast<UEdGraphNode*>(Node);
+		if(const UEdGraph* Graph = Node->GetGraph())
+		{
+			Issue.GraphName = Graph->GetFName();
+		}
+	}
+
+	Issue.Fingerprint = ValidatorX::MakeIssueFingerprint(GetClass(), Issue.PackageName, Issue.GetLocator(), RuleId);
+	return Issue;
+}
+
+FValidatorXIssue UBlueprintValidatorBase::MakeIssue(FName RuleId, EMessageSeverity::Type Severity, const UObject* Asset, FName MemberName, const UEdGraph* Graph) const
+{
+	FValidatorXIssue Issue = MakeIssue(RuleId, Severity, Asset, static_cast<const UEdGraphNode*>(nullptr), MemberName);
+	if(Graph)
+	{
+		Issue.GraphName = Graph->GetFName();
+		Issue.Fingerprint = ValidatorX::MakeIssueFingerprint(GetClass(), Issue.PackageName, Issue.GetLocator(), RuleId);
+	}
+	return Issue;
+}
+
+bool UBlueprintValidatorBase::ShouldReportIssue(const FValidatorXIssue& Issue) const
+{
+	return FValidatorXIssueFilter::Get().ShouldReport(Issue.Fingerprint, [&Issue]
+		{
+			return FString::Printf(TEXT("%s %s %s %s"), *GetNameSafe(Issue.Validator), *Issue.PackageName.ToString(), *Issue.GetLocator(), *Issue.RuleId.ToString());
+		});
+}
+
+bool UBlueprintValidatorBase::ReportIssue(FDataValidationContext& Context, const FValidatorXIssue& Issue)
+{
+	if(!ShouldReportIssue(Issue))
+	{
+		return false;
+	}
+
+	const bool bIsProblem = Issue.IsProblem();
+	FValidatorXIssueLog& IssueLog = FValidatorXIssueLog::Get();
+	IssueLog.Add(Issue);
+	FValidatorXValidatorStats::Get().AddIssue(GetClass(), bIsProblem);
+	FValidatorXReportWriter::Get().WriteIssue(Issue);
+
+	bIsError |= bIsProblem;
+
+	if(IssueLog.IsFormattingMessages())
+	{
+		TSharedRef<FTokenizedMessage> Message = Context.AddMessage(Issue.Severity, FormatIssue(Issue));
+		AddIssueTokens(Issue, *Message);
+	}
+	else if(bIsProblem && !bAddedDeferredSummary)
+	{
+		// Returning Invalid needs at least one message; one per asset instead of one per issue
+		Context.AddMessage(Issue.Severity, FText::Format(INVTEXT("'{0}' has {1} issues, recorded without message formatting (see the Issues panel of the ValidatorX tab, or run with -ValidatorXFormatMessages to print them)."),
+			Issue.GetAssetText(),
+			FText::FromString(GetClass()->GetName())));
+		bAddedDeferredSummary = true;
+	}
+	return true;
+}
@@ -0,0 +1,943 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Commandlets/ValidatorXCommandlet.h"
+#include "Algo/Find.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintSimilarity.h"
+#include "Analysis/BlueprintSnapshot.h"
+#include "Analysis/CompileProfiler.h"
+#include "Analysis/SubgraphHasher.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/DataValidation.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Reporting/IssueFilter.h"
+#include "Reporting/IssueLog.h"
+#include "Reporting/ReportWriter.h"
+#include "Reporting/ValidationProgress.h"
+#include "Reporting/ValidatorSchedule.h"
+#include "Reporting/ValidatorStats.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectGlobals.h"
+#include "ValidatorXConfigManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogValidatorXCommandlet, Log, All);
+
+UValidatorXCommandlet::UValidatorXCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UValidatorXCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Options;
+	ParseCommandLine(*Params, Tokens, Switches, Options);
+
+	if(const FString* LoadAheadOption = Options.Find(TEXT("LoadAhead")))
+	{
+		LoadAhead = FMath::Max(0, FCString::Atoi(**LoadAheadOption));
+	}
+
+	// Default ceiling: half of the physical memory, leaves room for GC to catch up
+	MemoryCeiling = static_cast<uint64>(FPlatformMemory::GetConstants().TotalPhysicalGB) * 1024 * 1024 * 1024 / 2;
+	if(const FString* CeilingOption = Options.Find(TEXT("MemoryCeilingMB")))
+	{
+		MemoryCeiling = FCString::Strtoui64(**CeilingOption, nullptr, 10) * 1024 * 1024;
+	}
+
+	const FString Mode = Options.FindRef(TEXT("Mode"));
+	if(Mode == TEXT("Similarity"))
+	{
+		return RunSimilarity(Options, Switches);
+	}
+	if(Mode == TEXT("Snapshot"))
+	{
+		return RunSnapshot(Options);
+	}
+	if(Mode == TEXT("CompileProfile"))
+	{
+		return RunCompileProfile(Options, Switches);
+	}
+	if(Mode == TEXT("Validate"))
+	{
+		return RunValidate(Options, Switches);
+	}
+	if(Mode == TEXT("Merge"))
+	{
+		return RunMerge(Options, Switches);
+	}
+	if(Mode == TEXT("Launch"))
+	{
+		return RunLaunch(Params, Options, Switches);
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Error, TEXT("Unknown or missing -Mode '%s'. Supported modes: Similarity, Snapshot, CompileProfile, Validate, Merge, Launch"), *Mode);
+	return 1;
+}
+
+void UValidatorXCommandlet::GatherBlueprintAssets(const TMap<FString, FString>& Options, TArray<FAssetData>& OutAssets) const
+{
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(FName(Options.Contains(TEXT("Path")) ? *Options[TEXT("Path")] : TEXT("/Game")));
+	Filter.bRecursivePaths = true;
+
+	AssetRegistry.GetAssets(Filter, OutAssets);
+
+	int32 ShardIndex = 0;
+	int32 NumShards = 1;
+	if(ParseShard(Options, ShardIndex, NumShards))
+	{
+		// Hash of the name only, so every process agrees on the split whatever it scanned
+		OutAssets.RemoveAll([ShardIndex, NumShards] (const FAssetData& AssetData)
+			{
+				return ValidatorX::HashStableString(AssetData.PackageName.ToString()) % NumShards != static_cast<uint64>(ShardIndex);
+			});
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("Shard %d/%d: %d Blueprints"), ShardIndex, NumShards, OutAssets.Num());
+	}
+
+	// Stable order so runs and reports are comparable
+	OutAssets.Sort([] (const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+}
+
+bool UValidatorXCommandlet::FilterChangedAssets(const TMap<FString, FString>& Options, TArray<FAssetData>& InOutAssets) const
+{
+	const FString* Range = Options.Find(TEXT("Changed"));
+	if(!Range)
+	{
+		return true;
+	}
+
+	TSet<FName> ChangedPackages;
+	TSet<FName> RemovedPackages;
+	if(!GetChangedPackages(*Range, Options.Contains(TEXT("Git")) ? Options[TEXT("Git")] : TEXT("git"), ChangedPackages, RemovedPackages))
+	{
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TSet<FName> Packages = ChangedPackages;
+	for(const FName PackageName : ChangedPackages)
+	{
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(PackageName, Referencers);
+		Packages.Append(Referencers);
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(PackageName, Dependencies);
+		Packages.Append(Dependencies);
+	}
+
+	// Gone from disk, but the registry still knows who referenced them: those now point at nothing
+	for(const FName PackageName : RemovedPackages)
+	{
+		TArray<FName> Referencers;
+		AssetRegistry.GetReferencers(PackageName, Referencers);
+		Packages.Append(Referencers);
+	}
+
+	InOutAssets.RemoveAll([&Packages] (const FAssetData& AssetData) { return !Packages.Contains(AssetData.PackageName); });
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d packages changed and %d deleted or renamed away in %s, %d Blueprints left with their direct referencers and dependencies"),
+		ChangedPackages.Num(), RemovedPackages.Num(), **Range, InOutAssets.Num());
+	return true;
+}
+
+bool UValidatorXCommandlet::GetChangedPackages(const FString& Range, const FString& GitPath, TSet<FName>& OutPackages, TSet<FName>& OutRemovedPackages)
+{
+	auto RunGit = [&GitPath] (const FString& Args, FString& OutStdOut)
+		{
+			int32 ReturnCode = INDEX_NONE;
+			FString StdErr;
+			if(!FPlatformProcess::ExecProcess(*GitPath, *Args, &ReturnCode, &OutStdOut, &StdErr) || ReturnCode != 0)
+			{
+				UE_LOG(LogValidatorXCommandlet, Error, TEXT("'%s %s' failed (%d): %s"), *GitPath, *Args, ReturnCode, *StdErr.TrimStartAndEnd());
+				return false;
+			}
+			return true;
+		};
+
+	// Paths from git diff are relative to the repository root, which may be above the project
+	FString Root;
+	const FString ProjectDir = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+	if(!RunGit(FString::Printf(TEXT("-C \"%s\" rev-parse --show-toplevel"), *ProjectDir), Root))
+	{
+		return false;
+	}
+	Root.TrimStartAndEndInline();
+
+	// Deletions and rename sources have nothing left to validate, but their referencers do
+	FString Diff;
+	if(!RunGit(FString::Printf(TEXT("-C \"%s\" -c core.quotepath=off diff --name-status -M --diff-filter=ACMRD %s -- \"*.uasset\" \"*.umap\""), *Root, *Range), Diff))
+	{
+		return false;
+	}
+
+	auto AddPackage = [&Root] (const FString& File, TSet<FName>& OutPackageNames)
+		{
+			FString PackageName;
+			if(FPackageName::TryConvertFilenameToLongPackageName(FPaths::Combine(Root, File), PackageName))
+			{
+				OutPackageNames.Add(FName(*PackageName));
+			}
+			else
+			{
+				UE_LOG(LogValidatorXCommandlet, Verbose, TEXT("'%s' is not in a mounted content directory"), *File);
+			}
+		};
+
+	// "<status>\t<path>", renames and copies "<status><score>\t<old path>\t<new path>"
+	TArray<FString> Lines;
+	Diff.ParseIntoArrayLines(Lines);
+	for(const FString& Line : Lines)
+	{
+		TArray<FString> Fields;
+		Line.ParseIntoArray(Fields, TEXT("\t"));
+		if(Fields.Num() < 2 || Fields[0].IsEmpty())
+		{
+			continue;
+		}
+
+		const TCHAR Status = Fields[0][0];
+		if(Status == TEXT('D'))
+		{
+			AddPackage(Fields[1], OutRemovedPackages);
+		}
+		else if((Status == TEXT('R') || Status == TEXT('C')) && Fields.Num() >= 3)
+		{
+			if(Status == TEXT('R'))
+			{
+				AddPackage(Fields[1], OutRemovedPackages);
+			}
+			AddPackage(Fields[2], OutPackages);
+		}
+		else
+		{
+			AddPackage(Fields[1], OutPackages);
+		}
+	}
+	return true;
+}
+
+bool UValidatorXCommandlet::ForEachLoadedBlueprint(const TArray<FAssetData>& Assets, TFunctionRef<void(int32 AssetIndex, UBlueprint* Blueprint)> Visitor) const
+{
+	const double StartTime = FPlatformTime::Seconds();
+	double WaitSeconds = 0.0;
+
+	// Loaded assets are held until visited so a collection in between does not drop them; their package is their outer
+	TArray<TStrongObjectPtr<UObject>> LoadedAssets;
+	LoadedAssets.SetNum(Assets.Num());
+	TBitArray<> IsLoadFinished(false, Assets.Num());
+
+	int32 NextRequest = 0;
+	int32 NumSinceCollect = 0;
+	int32 NumVisited = 0;
+	for(int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		// Ctrl+C requests an engine exit, stop between assets instead of dying mid-report
+		if(IsEngineExitRequested())
+		{
+			break;
+		}
+
+		const bool bIsOverCeiling = MemoryCeiling > 0 && FPlatformMemory::GetStats().UsedPhysical > MemoryCeiling;
+
+		// No new requests while over the ceiling, the assets already in flight are enough to keep the validators busy
+		while(!bIsOverCeiling && NextRequest < Assets.Num() && NextRequest - Index < LoadAhead)
+		{
+			const int32 RequestIndex = NextRequest++;
+			LoadPackageAsync(Assets[RequestIndex].PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+				[&LoadedAssets, &IsLoadFinished, RequestIndex, AssetName = Assets[RequestIndex].AssetName] (const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+				{
+					if(Result == EAsyncLoadingResult::Succeeded && Package)
+					{
+						LoadedAssets[RequestIndex].Reset(StaticFindObjectFast(UObject::StaticClass(), Package, AssetName));
+					}
+					IsLoadFinished[RequestIndex] = true;
+				}));
+		}
+
+		if(Index < NextRequest && !IsLoadFinished[Index])
+		{
+			const double WaitStartTime = FPlatformTime::Seconds();
+			ProcessAsyncLoadingUntilComplete([&IsLoadFinished, Index] { return bool(IsLoadFinished[Index]); }, 0.0);
+			WaitSeconds += FPlatformTime::Seconds() - WaitStartTime;
+		}
+
+		// Falls back to a synchronous load when the pipeline is off or the async load failed
+		UBlueprint* Blueprint = Cast<UBlueprint>(LoadedAssets[Index].Get());
+		if(!Blueprint)
+		{
+			Blueprint = Cast<UBlueprint>(Assets[Index].GetAsset());
+		}
+
+		if(Blueprint)
+		{
+			Visitor(Index, Blueprint);
+		}
+		else
+		{
+			UE_LOG(LogValidatorXCommandlet, Warning, TEXT("Could not load '%s'"), *Assets[Index].GetObjectPathString());
+		}
+		LoadedAssets[Index].Reset();
+		NumVisited++;
+
+		// Lets the loads in flight progress without waiting for them
+		if(Index + 1 < NextRequest)
+		{
+			ProcessAsyncLoading(true, false, LoadTimeSlice);
+		}
+
+		if(++NumSinceCollect >= GCInterval || bIsOverCeiling)
+		{
+			UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d / %d Blueprints processed, %.0f MB used"),
+				Index + 1, Assets.Num(), FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+			CollectGarbage(RF_NoFlags);
+			NumSinceCollect = 0;
+		}
+	}
+
+	if(NumVisited < Assets.Num())
+	{
+		// The completion callbacks of the loads in flight write into this frame, let them finish before it goes away
+		FlushAsyncLoading();
+		LoadedAssets.Reset();
+		UE_LOG(LogValidatorXCommandlet, Warning, TEXT("Cancelled after %d of %d Blueprints"), NumVisited, Assets.Num());
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Processed %d Blueprints in %.1fs, %.1fs of it waiting on loads (%d loads ahead)"),
+		NumVisited, FPlatformTime::Seconds() - StartTime, WaitSeconds, LoadAhead);
+	return NumVisited == Assets.Num();
+}
+
+FString UValidatorXCommandlet::GetReportPath(const TMap<FString, FString>& Options, const TCHAR* DefaultFileName)
+{
+	if(const FString* Output = Options.Find(TEXT("Output")))
+	{
+		return *Output;
+	}
+	return FPaths::ProjectSavedDir() / TEXT("ValidatorX") / DefaultFileName;
+}
+
+bool UValidatorXCommandlet::ParseShard(const TMap<FString, FString>& Options, int32& OutShardIndex, int32& OutNumShards)
+{
+	const FString* Shard = Options.Find(TEXT("Shard"));
+	FString Index;
+	FString Count;
+	if(!Shard || !Shard->Split(TEXT("/"), &Index, &Count))
+	{
+		return false;
+	}
+
+	OutShardIndex = FCString::Atoi(*Index);
+	OutNumShards = FCString::Atoi(*Count);
+	if(OutNumShards < 1 || OutShardIndex < 0 || OutShardIndex >= OutNumShards)
+	{
+		UE_LOG(LogValidatorXCommandlet, Error, TEXT("Ignoring malformed -Shard=%s, expected i/N with 0 <= i < N"), **Shard);
+		return false;
+	}
+	return true;
+}
+
+FString UValidatorXCommandlet::GetShardReportPath(const FString& ReportPath, int32 ShardIndex, int32 NumShards)
+{
+	return FString::Printf(TEXT("%s.shard%dof%d.%s"), *FPaths::GetBaseFilename(ReportPath, false), ShardIndex, NumShards, *FPaths::GetExtension(ReportPath));
+}
+
+FString UValidatorXCommandlet::GetSnapshotDir(const TMap<FString, FString>& Options)
+{
+	if(const FString* SnapshotDir = Options.Find(TEXT("SnapshotDir")))
+	{
+		return *SnapshotDir;
+	}
+	return FPaths::ProjectSavedDir() / TEXT("ValidatorX") / TEXT("Snapshots");
+}
+
+int32 UValidatorXCommandlet::RunSnapshot(const TMap<FString, FString>& Options)
+{
+	const int32 BatchSize = FMath::Max(1, Options.Contains(TEXT("BatchSize")) ? FCString::Atoi(*Options[TEXT("BatchSize")]) : 500);
+	const FString SnapshotDir = GetSnapshotDir(Options);
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FAssetData> Assets;
+	GatherBlueprintAssets(Options, Assets);
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Writing snapshots of %d Blueprints to %s"), Assets.Num(), *SnapshotDir);
+
+	// Old shards would be picked up as part of the new snapshot
+	TArray<FString> OldShards;
+	IFileManager::Get().FindFiles(OldShards, *(SnapshotDir / TEXT("*.vxsnap")), true, false);
+	for(const FString& OldShard : OldShards)
+	{
+		IFileManager::Get().Delete(*(SnapshotDir / OldShard));
+	}
+
+	FValidatorXSnapshotWriter Writer;
+	int32 NumShards = 0;
+	bool bSuccess = true;
+	auto FlushShard = [&] ()
+		{
+			if(Writer.NumBlueprints() > 0)
+			{
+				bSuccess &= Writer.Save(SnapshotDir / FString::Printf(TEXT("Shard_%04d.vxsnap"), NumShards++));
+			}
+		};
+
+	ForEachLoadedBlueprint(Assets, [&] (int32 AssetIndex, UBlueprint* Blueprint)
+		{
+			Writer.AddBlueprint(Blueprint);
+			if(Writer.NumBlueprints() >= BatchSize)
+			{
+				FlushShard();
+			}
+		});
+	FlushShard();
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d shards written in %.1fs"), NumShards, FPlatformTime::Seconds() - StartTime);
+	return bSuccess ? 0 : 1;
+}
+
+int32 UValidatorXCommandlet::RunSimilarity(const TMap<FString, FString>& Options, const TArray<FString>& Switches)
+{
+	const float Threshold = Options.Contains(TEXT("Threshold")) ? FCString::Atof(*Options[TEXT("Threshold")]) : 0.8f;
+	const int32 Bands = Options.Contains(TEXT("Bands")) ? FCString::Atoi(*Options[TEXT("Bands")]) : 16;
+	const int32 Rows = Options.Contains(TEXT("Rows")) ? FCString::Atoi(*Options[TEXT("Rows")]) : 4;
+	const int32 MinShingles = Options.Contains(TEXT("MinShingles")) ? FCString::Atoi(*Options[TEXT("MinShingles")]) : 20;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Only signatures and a few names are kept, the Blueprints themselves are collected as we go
+	struct FItem
+	{
+		FName PackageName;
+		FName ParentClass;
+		int32 NumShingles = 0;
+	};
+	TArray<FItem> Items;
+	FValidatorXMinHashIndex Index(Bands, Rows);
+	TArray<uint64> Shingles;
+
+	auto AddItem = [&] (FName PackageName, FName ParentClass)
+		{
+			if(Shingles.Num() < MinShingles)
+			{
+				// Data-only and near-empty Blueprints are trivially similar to each other
+				return;
+			}
+
+			FItem& Item = Items.AddDefaulted_GetRef();
+			Item.PackageName = PackageName;
+			Item.ParentClass = ParentClass;
+			Item.NumShingles = Shingles.Num();
+			Index.Add(Shingles);
+		};
+
+	if(Switches.Contains(TEXT("FromSnapshot")))
+	{
+		const FString SnapshotDir = GetSnapshotDir(Options);
+		TArray<FString> ShardFiles;
+		IFileManager::Get().FindFiles(ShardFiles, *(SnapshotDir / TEXT("*.vxsnap")), true, false);
+		ShardFiles.Sort();
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("Computing MinHash signatures from %d snapshot shards in %s"), ShardFiles.Num(), *SnapshotDir);
+
+		for(const FString& ShardFile : ShardFiles)
+		{
+			FValidatorXSnapshotReader Snapshot;
+			if(!Snapshot.Open(SnapshotDir / ShardFile))
+			{
+				UE_LOG(LogValidatorXCommandlet, Warning, TEXT("Skipping unreadable shard '%s'"), *ShardFile);
+				continue;
+			}
+
+			const TConstArrayView<ValidatorX::Snapshot::FBlueprintRecord> Blueprints = Snapshot.GetBlueprints();
+			for(int32 BlueprintIndex = 0; BlueprintIndex < Blueprints.Num(); ++BlueprintIndex)
+			{
+				const FUtf8StringView PackageName = Snapshot.GetString(Blueprints[BlueprintIndex].PackageName);
+				const FUtf8StringView ParentPath = Snapshot.GetString(Blueprints[BlueprintIndex].ParentClass);
+
+				// Parent classes are stored as object paths, the report uses class names
+				int32 NameStart = INDEX_NONE;
+				ParentPath.FindLastChar('.', NameStart);
+				const FUtf8StringView ParentName = ParentPath.RightChop(NameStart + 1);
+
+				ValidatorX::CollectSnapshotShingles(Snapshot, BlueprintIndex, Shingles);
+				AddItem(FName(FString(PackageName.Len(), PackageName.GetData())), FName(FString(ParentName.Len(), ParentName.GetData())));
+			}
+		}
+	}
+	else
+	{
+		TArray<FAssetData> Assets;
+		GatherBlueprintAssets(Options, Assets);
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("Computing MinHash signatures for %d Blueprints"), Assets.Num());
+
+		ForEachLoadedBlueprint(Assets, [&] (int32 AssetIndex, UBlueprint* Blueprint)
+			{
+				ValidatorX::CollectBlueprintShingles(Blueprint, Shingles);
+				AddItem(Assets[AssetIndex].PackageName, Blueprint->ParentClass ? Blueprint->ParentClass->GetFName() : NAME_None);
+			});
+	}
+
+	TArray<FValidatorXMinHashIndex::FSimilarPair> Pairs;
+	Index.FindSimilarPairs(Threshold, Pairs);
+
+	TArray<TArray<int32>> Clusters;
+	FValidatorXMinHashIndex::BuildClusters(Index.Num(), Pairs, Clusters);
+	Clusters.Sort([] (const TArray<int32>& A, const TArray<int32>& B) { return A.Num() > B.Num(); });
+
+	TMap<uint64, float> PairSimilarities;
+	for(const FValidatorXMinHashIndex::FSimilarPair& Pair : Pairs)
+	{
+		PairSimilarities.Add((static_cast<uint64>(Pair.A) << 32) | static_cast<uint32>(Pair.B), Pair.Similarity);
+	}
+
+	FString Report = TEXT("Cluster,Package,ParentClass,Shingles,SimilarityToFirst,Suggestion\n");
+	for(int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+	{
+		TArray<int32>& Members = Clusters[ClusterIndex];
+		Members.Sort();
+
+		bool bSharedParent = true;
+		for(const int32 Member : Members)
+		{
+			bSharedParent &= Items[Member].ParentClass == Items[Members[0]].ParentClass;
+		}
+
+		const FString Suggestion = bSharedParent
+			? FString::Printf(TEXT("Move the shared graphs into parent %s"), *Items[Members[0]].ParentClass.ToString())
+			: FString(TEXT("Introduce a shared parent Blueprint"));
+
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("Cluster %d: %d near-duplicate Blueprints, e.g. %s. %s"),
+			ClusterIndex, Members.Num(), *Items[Members[0]].PackageName.ToString(), *Suggestion);
+
+		for(const int32 Member : Members)
+		{
+			// Members connected only through other members have no direct estimate
+			const uint64 PairKey = (static_cast<uint64>(Members[0]) << 32) | static_cast<uint32>(Member);
+			const float* Similarity = PairSimilarities.Find(PairKey);
+			FString SimilarityText;
+			if(Member == Members[0])
+			{
+				SimilarityText = TEXT("1.00");
+			}
+			else if(Similarity)
+			{
+				SimilarityText = FString::Printf(TEXT("%.2f"), *Similarity);
+			}
+
+			Report += FString::Printf(TEXT("%d,%s,%s,%d,%s,%s\n"),
+				ClusterIndex,
+				*Items[Member].PackageName.ToString(),
+				*Items[Member].ParentClass.ToString(),
+				Items[Member].NumShingles,
+				*SimilarityText,
+				*Suggestion);
+		}
+	}
+
+	const FString ReportPath = GetReportPath(Options, TEXT("SimilarityClusters.csv"));
+	if(!FFileHelper::SaveStringToFile(Report, *ReportPath))
+	{
+		UE_LOG(LogValidatorXCommandlet, Error, TEXT("Could not write '%s'"), *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d Blueprints indexed, %d similar pairs, %d clusters in %.1fs. Report: %s"),
+		Index.Num(), Pairs.Num(), Clusters.Num(), FPlatformTime::Seconds() - StartTime, *ReportPath);
+	return 0;
+}
+
+int32 UValidatorXCommandlet::RunCompileProfile(const TMap<FString, FString>& Options, const TArray<FString>& Switches)
+{
+	const double BudgetMs = Options.Contains(TEXT("Budget")) ? FCString::Atod(*Options[TEXT("Budget")]) : 250.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FAssetData> Assets;
+	GatherBlueprintAssets(Options, Assets);
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Compiling %d Blueprints with timing"), Assets.Num());
+
+	FValidatorXCompileProfiler& Profiler = FValidatorXCompileProfiler::Get();
+	Profiler.Load();
+
+	TArray<FValidatorXCompileSample> Samples;
+	ForEachLoadedBlueprint(Assets, [&] (int32 AssetIndex, UBlueprint* Blueprint)
+		{
+			Samples.Add(Profiler.ProfileBlueprint(Blueprint));
+			if(Samples.Num() % GCInterval == 0)
+			{
+				Profiler.Flush();
+			}
+		});
+	Profiler.Flush();
+
+	Samples.Sort([] (const FValidatorXCompileSample& A, const FValidatorXCompileSample& B) { return A.CompileMs > B.CompileMs; });
+
+	int32 NumOverBudget = 0;
+	double TotalMs = 0.0;
+	for(const FValidatorXCompileSample& Sample : Samples)
+	{
+		TotalMs += Sample.CompileMs;
+		if(Sample.CompileMs <= BudgetMs) continue;
+
+		NumOverBudget++;
+		UE_LOG(LogValidatorXCommandlet, Warning, TEXT("%s: %.0f ms (budget %.0f ms), %d graphs, %d nodes, largest graph %d, %d macro instances%s"),
+			*Sample.PackageName.ToString(), Sample.CompileMs, BudgetMs,
+			Sample.Metrics.NumGraphs, Sample.Metrics.NumNodes, Sample.Metrics.MaxGraphNodes, Sample.Metrics.NumMacroInstances,
+			Sample.bSucceeded ? TEXT("") : TEXT(" (compile errors)"));
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d Blueprints compiled in %.1f s of compile time (%.1f s total), %d over budget. Correlation of compile time with %s"),
+		Samples.Num(), TotalMs / 1000.0, FPlatformTime::Seconds() - StartTime, NumOverBudget, *FValidatorXCompileProfiler::DescribeCorrelations(Samples));
+
+	return Switches.Contains(TEXT("FailOverBudget")) && NumOverBudget > 0 ? 1 : 0;
+}
+
+int32 UValidatorXCommandlet::RunValidate(const TMap<FString, FString>& Options, const TArray<FString>& Switches)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> ValidatorNames;
+	if(const FString* ValidatorList = Options.Find(TEXT("Validators")))
+	{
+		ValidatorList->ParseIntoArray(ValidatorNames, TEXT(","));
+	}
+
+	const FValidatorXPreset* Preset = nullptr;
+	if(const FString* PresetName = Options.Find(TEXT("Preset")))
+	{
+		Preset = FValidatorXConfigManager::Get().FindPreset(FName(**PresetName));
+		if(!Preset)
+		{
+			UE_LOG(LogValidatorXCommandlet, Error, TEXT("Unknown preset '%s'"), **PresetName);
+			return 1;
+		}
+	}
+
+	// Own instances, the editor ones may be disabled from the ValidatorX tab
+	TArray<TStrongObjectPtr<UBlueprintValidatorBase>> Validators;
+	for(TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if(!Class->IsChildOf(UBlueprintValidatorBase::StaticClass()) || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+		if(ValidatorNames.Num() > 0 && !ValidatorNames.Contains(Class->GetName()))
+		{
+			continue;
+		}
+		if(Preset && !Preset->IncludesValidator(Class->GetDefaultObject<UBlueprintValidatorBase>()))
+		{
+			continue;
+		}
+		Validators.Emplace(NewObject<UBlueprintValidatorBase>(GetTransientPackage(), Class));
+	}
+
+	FValidatorXReportWriter& Report = FValidatorXReportWriter::Get();
+	if(!Report.IsOpen() || Options.Contains(TEXT("Report")))
+	{
+		FString ReportPath = Options.Contains(TEXT("Report")) ? Options[TEXT("Report")] : GetReportPath(Options, TEXT("ValidatorX.sarif"));
+
+		int32 ShardIndex = 0;
+		int32 NumShards = 1;
+		if(ParseShard(Options, ShardIndex, NumShards))
+		{
+			ReportPath = GetShardReportPath(ReportPath, ShardIndex, NumShards);
+		}
+
+		if(!Report.Open(ReportPath, FValidatorXReportWriter::GetFormatForPath(ReportPath)))
+		{
+			return 1;
+		}
+	}
+	FValidatorXValidatorStats::Get().Reset();
+
+	TArray<FAssetData> Assets;
+	GatherBlueprintAssets(Options, Assets);
+	if(!FilterChangedAssets(Options, Assets))
+	{
+		Report.Close();
+		return 1;
+	}
+
+	// Nothing to load for assets no validator can have findings on
+	const int32 NumGathered = Assets.Num();
+	Assets.RemoveAll([&Validators] (const FAssetData& AssetData)
+		{
+			return !Validators.ContainsByPredicate([&AssetData] (const TStrongObjectPtr<UBlueprintValidatorBase>& Validator)
+				{
+					return Validator->CanValidateAssetData(AssetData);
+				});
+		});
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Validating %d Blueprints with %d validators, %d skipped from registry data"),
+		Assets.Num(), Validators.Num(), NumGathered - Assets.Num());
+
+	int32 NumInvalid = 0;
+	FValidatorXValidationProgress Progress(Assets.Num());
+	double LastProgressTime = FPlatformTime::Seconds();
+	const bool bCompleted = ForEachLoadedBlueprint(Assets, [&] (int32 AssetIndex, UBlueprint* Blueprint)
+		{
+			FDataValidationContext Context(false, EDataValidationUsecase::Commandlet, {});
+			bool bIsInvalid = false;
+			for(const TStrongObjectPtr<UBlueprintValidatorBase>& Validator : Validators)
+			{
+				// A validator is one pass over the graphs, the finest point a large asset can stop at
+				if(IsEngineExitRequested())
+				{
+					break;
+				}
+				bIsInvalid |= Validator->RunValidation(Assets[AssetIndex], Blueprint, Context) == EDataValidationResult::Invalid;
+			}
+			NumInvalid += bIsInvalid ? 1 : 0;
+
+			// Issues already went to the report, nobody reads the log of a commandlet
+			FValidatorXIssueLog::Get().Reset();
+
+			Progress.AddAsset(ValidatorX::GetAssetTagCount(Assets[AssetIndex], ValidatorX::AssetTags::NumNodes));
+			if(FPlatformTime::Seconds() - LastProgressTime >= 10.0)
+			{
+				LastProgressTime = FPlatformTime::Seconds();
+				UE_LOG(LogValidatorXCommandlet, Display, TEXT("%s"), *Progress.GetText().ToString());
+			}
+		});
+
+	// Whatever was validated before a cancel is already in the report, closing it keeps it well-formed
+	const FString ReportPath = Report.GetPath();
+	Report.Close();
+
+	// A full pass is the best sample of validator costs the editor schedule gets
+	FValidatorXValidatorSchedule::Get().Save();
+
+	if(!bCompleted)
+	{
+		UE_LOG(LogValidatorXCommandlet, Warning, TEXT("Validation cancelled after %d of %d Blueprints, %d with issues. Partial report: %s"),
+			Progress.GetNumDone(), Assets.Num(), NumInvalid, *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d of %d Blueprints have issues, validated in %.1fs. Report: %s"),
+		NumInvalid, Assets.Num(), FPlatformTime::Seconds() - StartTime, *ReportPath);
+	for(const TPair<const UClass*, FValidatorXValidatorStats::FEntry>& Pair : FValidatorXValidatorStats::Get().GetSortedEntries())
+	{
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("  %s: %.2f s over %d assets, %d issues"),
+			*GetNameSafe(Pair.Key), Pair.Value.Seconds, Pair.Value.NumAssets, Pair.Value.NumIssues);
+	}
+
+	return Switches.Contains(TEXT("FailOnIssues")) && NumInvalid > 0 ? 1 : 0;
+}
+
+int32 UValidatorXCommandlet::MergeReports(const TArray<FString>& InputPaths, const FString& OutputPath) const
+{
+	FValidatorXReportWriter Output;
+	if(!Output.Open(OutputPath, FValidatorXReportWriter::GetFormatForPath(OutputPath)))
+	{
+		return INDEX_NONE;
+	}
+
+	TSet<uint64> Fingerprints;
+	TMap<FString, int32> IssuesPerRule;
+	TMap<FString, FValidatorXReportTiming> Timings;
+	int32 NumDuplicates = 0;
+	int32 NumProblems = 0;
+
+	for(const FString& InputPath : InputPaths)
+	{
+		TArray<FValidatorXReportTiming> InputTimings;
+		const bool bRead = FValidatorXReportWriter::ReadReport(InputPath, [&] (const FValidatorXReportRecord& Record)
+			{
+				// Shards never overlap, duplicates come from reports of overlapping or repeated runs
+				bool bAlreadyMerged = false;
+				if(Record.Fingerprint != 0)
+				{
+					Fingerprints.Add(Record.Fingerprint, &bAlreadyMerged);
+				}
+				if(bAlreadyMerged)
+				{
+					NumDuplicates++;
+					return;
+				}
+
+				Output.WriteRecord(Record);
+				IssuesPerRule.FindOrAdd(Record.RuleId)++;
+				NumProblems += Record.Level == TEXT("error") || Record.Level == TEXT("warning") ? 1 : 0;
+			}, InputTimings);
+
+		if(!bRead)
+		{
+			UE_LOG(LogValidatorXCommandlet, Error, TEXT("Could not read report '%s'"), *InputPath);
+			return INDEX_NONE;
+		}
+
+		for(const FValidatorXReportTiming& InputTiming : InputTimings)
+		{
+			FValidatorXReportTiming& Timing = Timings.FindOrAdd(InputTiming.Validator);
+			Timing.Validator = InputTiming.Validator;
+			Timing.NumAssets += InputTiming.NumAssets;
+			Timing.NumIssues += InputTiming.NumIssues;
+			Timing.Seconds += InputTiming.Seconds;
+		}
+	}
+
+	TArray<FValidatorXReportTiming> SortedTimings;
+	Timings.GenerateValueArray(SortedTimings);
+	SortedTimings.Sort([] (const FValidatorXReportTiming& A, const FValidatorXReportTiming& B) { return A.Seconds > B.Seconds; });
+	Output.SetTimings(SortedTimings);
+
+	const int32 NumIssues = Output.GetNumIssues();
+	Output.Close();
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Merged %d reports into %s: %d issues (%d errors or warnings), %d duplicates dropped"),
+		InputPaths.Num(), *OutputPath, NumIssues, NumProblems, NumDuplicates);
+
+	IssuesPerRule.ValueSort([] (int32 A, int32 B) { return A > B; });
+	for(const TPair<FString, int32>& Pair : IssuesPerRule)
+	{
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("  %s: %d"), *Pair.Key, Pair.Value);
+	}
+	for(const FValidatorXReportTiming& Timing : SortedTimings)
+	{
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("  %s: %.2f s over %d assets"), *Timing.Validator, Timing.Seconds, Timing.NumAssets);
+	}
+
+	return NumProblems;
+}
+
+int32 UValidatorXCommandlet::RunMerge(const TMap<FString, FString>& Options, const TArray<FString>& Switches)
+{
+	const FString Inputs = Options.Contains(TEXT("Inputs")) ? Options[TEXT("Inputs")] : FPaths::ProjectSavedDir() / TEXT("ValidatorX");
+
+	// A directory means every shard report in it
+	const bool bIsDirectory = IFileManager::Get().DirectoryExists(*Inputs);
+	const FString Directory = bIsDirectory ? Inputs : FPaths::GetPath(Inputs);
+	const FString Wildcard = bIsDirectory ? Inputs / TEXT("*.shard*of*.*") : Inputs;
+
+	TArray<FString> FileNames;
+	IFileManager::Get().FindFiles(FileNames, *Wildcard, true, false);
+	FileNames.Sort();
+
+	TArray<FString> InputPaths;
+	for(const FString& FileName : FileNames)
+	{
+		InputPaths.Add(Directory / FileName);
+	}
+
+	if(InputPaths.Num() == 0)
+	{
+		UE_LOG(LogValidatorXCommandlet, Error, TEXT("No reports found for -Inputs=%s"), *Inputs);
+		return 1;
+	}
+
+	const int32 NumProblems = MergeReports(InputPaths, GetReportPath(Options, TEXT("ValidatorX.sarif")));
+	if(NumProblems == INDEX_NONE)
+	{
+		return 1;
+	}
+	return Switches.Contains(TEXT("FailOnIssues")) && NumProblems > 0 ? 1 : 0;
+}
+
+int32 UValidatorXCommandlet::RunLaunch(const FString& Params, const TMap<FString, FString>& Options, const TArray<FString>& Switches)
+{
+	const int32 NumShards = FMath::Max(1, Options.Contains(TEXT("Shards")) ? FCString::Atoi(*Options[TEXT("Shards")]) : FPlatformMisc::NumberOfCores() / 2);
+	const FString OutputPath = GetReportPath(Options, TEXT("ValidatorX.sarif"));
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Shards stream JSON lines, which the merge reads line by line
+	const FString ShardReportPath = FPaths::GetBaseFilename(OutputPath, false) + TEXT(".jsonl");
+
+	FString ForwardedParams;
+	for(const TPair<FString, FString>& Option : Options)
+	{
+		static const TCHAR* OwnOptions[] = { TEXT("run"), TEXT("Mode"), TEXT("Shards"), TEXT("Shard"), TEXT("Output"), TEXT("Report"), TEXT("ValidatorXWriteBaseline") };
+		if(Algo::FindByPredicate(OwnOptions, [&Option] (const TCHAR* Own) { return Option.Key == Own; }))
+		{
+			continue;
+		}
+		ForwardedParams += FString::Printf(TEXT(" -%s=\"%s\""), *Option.Key, *Option.Value);
+	}
+	for(const FString& Switch : Switches)
+	{
+		// Issues fail the merged report, not the shards
+		if(Switch != TEXT("FailOnIssues"))
+		{
+			ForwardedParams += FString::Printf(TEXT(" -%s"), *Switch);
+		}
+	}
+
+	// Each shard records its own baseline, merged below and written by this process on shutdown
+	const FString BaselinePath = Options.Contains(TEXT("ValidatorXWriteBaseline")) ? Options[TEXT("ValidatorXWriteBaseline")] : FString();
+	const bool bWriteBaseline = !BaselinePath.IsEmpty();
+
+	const FString ExecutablePath = FPlatformProcess::ExecutablePath();
+	const FString ProjectPath = FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath());
+
+	TArray<FProcHandle> Processes;
+	TArray<FString> ShardReports;
+	for(int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+	{
+		// Shards would race on the schedule, the subgraph table and the editor config, only this process saves them
+		FString Arguments = FString::Printf(TEXT("\"%s\" -run=ValidatorX -Mode=Validate -Shard=%d/%d -Report=\"%s\"%s -ValidatorXNoPersist -unattended -nopause -nosplash"),
+			*ProjectPath, ShardIndex, NumShards, *ShardReportPath, *ForwardedParams);
+		if(bWriteBaseline)
+		{
+			Arguments += FString::Printf(TEXT(" -ValidatorXWriteBaseline=\"%s\""), *GetShardReportPath(BaselinePath, ShardIndex, NumShards));
+		}
+
+		FProcHandle Process = FPlatformProcess::CreateProc(*ExecutablePath, *Arguments, true, true, true, nullptr, 0, nullptr, nullptr);
+		if(!Process.IsValid())
+		{
+			UE_LOG(LogValidatorXCommandlet, Error, TEXT("Could not start shard %d: %s %s"), ShardIndex, *ExecutablePath, *Arguments);
+			continue;
+		}
+
+		Processes.Add(Process);
+		ShardReports.Add(GetShardReportPath(ShardReportPath, ShardIndex, NumShards));
+	}
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("Started %d of %d shards"), Processes.Num(), NumShards);
+
+	bool bAllSucceeded = Processes.Num() == NumShards;
+	for(int32 ShardIndex = 0; ShardIndex < Processes.Num(); ++ShardIndex)
+	{
+		FPlatformProcess::WaitForProc(Processes[ShardIndex]);
+
+		int32 ReturnCode = 0;
+		FPlatformProcess::GetProcReturnCode(Processes[ShardIndex], &ReturnCode);
+		FPlatformProcess::CloseProc(Processes[ShardIndex]);
+
+		UE_LOG(LogValidatorXCommandlet, Display, TEXT("Shard %d finished with code %d after %.1fs"), ShardIndex, ReturnCode, FPlatformTime::Seconds() - StartTime);
+		bAllSucceeded &= ReturnCode == 0;
+	}
+
+	if(bWriteBaseline)
+	{
+		for(int32 ShardIndex = 0; ShardIndex < NumShards; ++ShardIndex)
+		{
+			const FString ShardBaselinePath = GetShardReportPath(BaselinePath, ShardIndex, NumShards);
+			bAllSucceeded &= FValidatorXIssueFilter::Get().AddRecordedIssues(ShardBaselinePath);
+			IFileManager::Get().Delete(*ShardBaselinePath, false, false, true);
+		}
+	}
+
+	const int32 NumProblems = MergeReports(ShardReports, OutputPath);
+	if(NumProblems == INDEX_NONE || !bAllSucceeded)
+	{
+		return 1;
+	}
+
+	UE_LOG(LogValidatorXCommandlet, Display, TEXT("%d shards validated and merged in %.1fs"), NumShards, FPlatformTime::Seconds() - StartTime);
+	return Switches.Contains(TEXT("FailOnIssues")) && NumProblems > 0 ? 1 : 0;
+}
@@ -0,0 +1,273 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/HealthTable.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/Blueprint.h"
+#include "Reporting/IssueLog.h"
+
+namespace ValidatorX
+{
+	namespace
+	{
+		const FName HealthColumnTags[FValidatorXHealthTable::NumMetrics] =
+		{
+			AssetTags::NumNodes,
+			AssetTags::NumGraphs,
+			AssetTags::MaxGraphNodes,
+			AssetTags::NumMacroInstances,
+			AssetTags::NumTickingEvents,
+			AssetTags::EstimatedTickCost,
+			AssetTags::NumHardReferences,
+			AssetTags::NumIssues
+		};
+
+		void RankNames(const TArray<FName>& Names, TArray<int32>& OutRanks)
+		{
+			TArray<int32> Order;
+			Order.SetNumUninitialized(Names.Num());
+			for(int32 Index = 0; Index < Names.Num(); ++Index)
+			{
+				Order[Index] = Index;
+			}
+			Order.Sort([&Names] (int32 A, int32 B) { return Names[A].LexicalLess(Names[B]); });
+
+			OutRanks.SetNumUninitialized(Names.Num());
+			for(int32 Rank = 0; Rank < Order.Num(); ++Rank)
+			{
+				OutRanks[Order[Rank]] = Rank;
+			}
+		}
+
+		void AddToGroup(FValidatorXHealthTable::FGroup& Group, const FValidatorXHealthTable& Table, int32 Row)
+		{
+			Group.NumAssets++;
+			for(int32 Metric = 0; Metric < FValidatorXHealthTable::NumMetrics; ++Metric)
+			{
+				const EValidatorXHealthColumn Column = static_cast<EValidatorXHealthColumn>(FValidatorXHealthTable::FirstMetric + Metric);
+				const int32 Value = FMath::Max(0, Table.GetValue(Row, Column));
+				Group.Values[Metric] = Column == EValidatorXHealthColumn::MaxGraphNodes ? FMath::Max(Group.Values[Metric], Value) : Group.Values[Metric] + Value;
+			}
+		}
+	}
+}
+
+void FValidatorXHealthTable::Build(const FString& Path)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(FName(*Path));
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+
+	PackageNames.Reset(Assets.Num());
+	AssetNames.Reset(Assets.Num());
+	Folders.Reset(Assets.Num());
+	SearchPaths.Reset(Assets.Num());
+	RowByPackage.Reset();
+	NumTickingAssets = 0;
+	for(TArray<int32>& Column : Metrics)
+	{
+		Column.Reset(Assets.Num());
+	}
+
+	for(const FAssetData& AssetData : Assets)
+	{
+		RowByPackage.Add(AssetData.PackageName, PackageNames.Num());
+		PackageNames.Add(AssetData.PackageName);
+		AssetNames.Add(AssetData.AssetName);
+		Folders.Add(AssetData.PackagePath);
+		SearchPaths.Add(AssetData.PackageName.ToString().ToLower());
+
+		for(int32 Metric = 0; Metric < NumMetrics; ++Metric)
+		{
+			Metrics[Metric].Add(ValidatorX::GetAssetTagCount(AssetData, ValidatorX::HealthColumnTags[Metric]));
+		}
+		NumTickingAssets += ValidatorX::GetAssetTagCount(AssetData, ValidatorX::AssetTags::CanEverTick) > 0 ? 1 : 0;
+	}
+
+	ValidatorX::RankNames(PackageNames, NameRanks);
+	ValidatorX::RankNames(Folders, FolderRanks);
+
+	UpdateIssues();
+}
+
+void FValidatorXHealthTable::UpdateIssues()
+{
+	const FValidatorXIssueLog& IssueLog = FValidatorXIssueLog::Get();
+	TArray<int32>& Issues = Metrics[MetricIndex(EValidatorXHealthColumn::Issues)];
+
+	for(int32 Row = 0; Row < PackageNames.Num(); ++Row)
+	{
+		if(IssueLog.WasValidated(PackageNames[Row]))
+		{
+			Issues[Row] = 0;
+		}
+	}
+
+	TMap<TPair<int32, int32>, int32> IssuesPerValidator;
+	ValidatorIssues.Reset();
+	IssueLog.ForEachIssue([&] (const FValidatorXIssue& Issue)
+		{
+			const int32* Row = RowByPackage.Find(Issue.PackageName);
+			if(!Row || !Issue.Validator || !Issue.IsProblem())
+			{
+				return;
+			}
+
+			Issues[*Row]++;
+			const int32 ValidatorIndex = ValidatorNames.AddUnique(Issue.Validator->GetFName());
+			IssuesPerValidator.FindOrAdd({ *Row, ValidatorIndex })++;
+		});
+
+	for(const TPair<TPair<int32, int32>, int32>& Pair : IssuesPerValidator)
+	{
+		ValidatorIssues.Add({ Pair.Key.Key, Pair.Key.Value, Pair.Value });
+	}
+	ValidatorIssues.Sort([] (const FValidatorIssues& A, const FValidatorIssues& B) { return A.Row < B.Row; });
+}
+
+void FValidatorXHealthTable::Query(const FString& Filter, int32 ValidatorIndex, const TArray<int32>* PreviousRows, TArray<int32>& OutRows) const
+{
+	TBitArray<> HasValidatorIssues;
+	if(ValidatorIndex != INDEX_NONE)
+	{
+		HasValidatorIssues.Init(false, Num());
+		for(const FValidatorIssues& Entry : ValidatorIssues)
+		{
+			if(Entry.ValidatorIndex == ValidatorIndex)
+			{
+				HasValidatorIssues[Entry.Row] = true;
+			}
+		}
+	}
+
+	const FString LowerFilter = Filter.ToLower();
+	auto Matches = [&] (int32 Row)
+		{
+			return (ValidatorIndex == INDEX_NONE || HasValidatorIssues[Row]) && (LowerFilter.IsEmpty() || SearchPaths[Row].Contains(LowerFilter, ESearchCase::CaseSensitive));
+		};
+
+	OutRows.Reset();
+	if(PreviousRows)
+	{
+		for(const int32 Row : *PreviousRows)
+		{
+			if(Matches(Row))
+			{
+				OutRows.Add(Row);
+			}
+		}
+	}
+	else
+	{
+		for(int32 Row = 0; Row < Num(); ++Row)
+		{
+			if(Matches(Row))
+			{
+				OutRows.Add(Row);
+			}
+		}
+	}
+}
+
+void FValidatorXHealthTable::SortRows(TArray<int32>& Rows, EValidatorXHealthColumn Column, bool bDescending) const
+{
+	const TArray<int32>& Keys = Column == EValidatorXHealthColumn::Name ? NameRanks
+		: Column == EValidatorXHealthColumn::Folder ? FolderRanks
+		: Metrics[MetricIndex(Column)];
+
+	// Ties fall back to the name so the order is stable between refreshes
+	Rows.Sort([&Keys, this, bDescending] (int32 A, int32 B)
+		{
+			if(Keys[A] != Keys[B])
+			{
+				return bDescending ? Keys[A] > Keys[B] : Keys[A] < Keys[B];
+			}
+			return NameRanks[A] < NameRanks[B];
+		});
+}
+
+void FValidatorXHealthTable::GroupByFolder(const TArray<int32>& Rows, TArray<FGroup>& OutGroups) const
+{
+	TMap<FName, int32> GroupByKey;
+	OutGroups.Reset();
+	for(const int32 Row : Rows)
+	{
+		int32& GroupIndex = GroupByKey.FindOrAdd(Folders[Row], INDEX_NONE);
+		if(GroupIndex == INDEX_NONE)
+		{
+			GroupIndex = OutGroups.Num();
+			OutGroups.AddDefaulted_GetRef().Key = Folders[Row];
+		}
+		ValidatorX::AddToGroup(OutGroups[GroupIndex], *this, Row);
+	}
+}
+
+void FValidatorXHealthTable::GroupByValidator(const TArray<int32>& Rows, TArray<FGroup>& OutGroups) const
+{
+	TBitArray<> IsIncluded(false, Num());
+	for(const int32 Row : Rows)
+	{
+		IsIncluded[Row] = true;
+	}
+
+	OutGroups.Reset();
+	OutGroups.SetNum(ValidatorNames.Num());
+	for(int32 ValidatorIndex = 0; ValidatorIndex < ValidatorNames.Num(); ++ValidatorIndex)
+	{
+		OutGroups[ValidatorIndex].Key = ValidatorNames[ValidatorIndex];
+	}
+
+	for(const FValidatorIssues& Entry : ValidatorIssues)
+	{
+		if(IsIncluded[Entry.Row])
+		{
+			FGroup& Group = OutGroups[Entry.ValidatorIndex];
+			ValidatorX::AddToGroup(Group, *this, Entry.Row);
+
+			// The asset's total issue count was added above, keep this validator's share only
+			int32& Issues = Group.Values[MetricIndex(EValidatorXHealthColumn::Issues)];
+			Issues += Entry.NumIssues - FMath::Max(0, GetValue(Entry.Row, EValidatorXHealthColumn::Issues));
+		}
+	}
+	OutGroups.RemoveAll([] (const FGroup& Group) { return Group.NumAssets == 0; });
+}
+
+void FValidatorXHealthTable::SortGroups(TArray<FGroup>& Groups, EValidatorXHealthColumn Column, bool bDescending)
+{
+	if(Column == EValidatorXHealthColumn::Name || Column == EValidatorXHealthColumn::Folder)
+	{
+		Groups.Sort([bDescending] (const FGroup& A, const FGroup& B) { return bDescending ? B.Key.LexicalLess(A.Key) : A.Key.LexicalLess(B.Key); });
+		return;
+	}
+
+	const int32 Metric = MetricIndex(Column);
+	Groups.Sort([Metric, bDescending] (const FGroup& A, const FGroup& B)
+		{
+			return bDescending ? A.Values[Metric] > B.Values[Metric] : A.Values[Metric] < B.Values[Metric];
+		});
+}
+
+FText FValidatorXHealthTable::GetColumnLabel(EValidatorXHealthColumn Column)
+{
+	switch(Column)
+	{
+	case EValidatorXHealthColumn::Name:           return INVTEXT("Asset");
+	case EValidatorXHealthColumn::Folder:         return INVTEXT("Folder");
+	case EValidatorXHealthColumn::Nodes:          return INVTEXT("Nodes");
+	case EValidatorXHealthColumn::Graphs:         return INVTEXT("Graphs");
+	case EValidatorXHealthColumn::MaxGraphNodes:  return INVTEXT("Largest Graph");
+	case EValidatorXHealthColumn::MacroInstances: return INVTEXT("Macros");
+	case EValidatorXHealthColumn::TickingEvents:  return INVTEXT("Ticking");
+	case EValidatorXHealthColumn::TickCost:       return INVTEXT("Tick Cost");
+	case EValidatorXHealthColumn::HardReferences: return INVTEXT("Hard Refs");
+	case EValidatorXHealthColumn::Issues:         return INVTEXT("Issues");
+	default:                                      return FText::GetEmpty();
+	}
+}
@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/IssueFilter.h"
+#include "Analysis/SubgraphHasher.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ValidatorXStateFiles.h"
+
+namespace ValidatorX
+{
+	uint64 MakeIssueFingerprint(const UClass* ValidatorClass, FName PackageName, const FString& Locator, FName RuleKey)
+	{
+		uint64 Fingerprint = HashStableString(ValidatorClass ? ValidatorClass->GetName() : FString());
+		Fingerprint = CombineStableHash(Fingerprint, HashStableString(PackageName.ToString()));
+		Fingerprint = CombineStableHash(Fingerprint, HashStableString(Locator));
+		Fingerprint = CombineStableHash(Fingerprint, HashStableString(RuleKey.ToString()));
+		return Fingerprint;
+	}
+}
+
+bool FValidatorXIssueFilter::LoadFingerprints(const FString& FilePath, TSet<uint64>& OutFingerprints)
+{
+	TArray<FString> Lines;
+	if(!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+	{
+		return false;
+	}
+
+	for(FString& Line : Lines)
+	{
+		int32 CommentStart = INDEX_NONE;
+		if(Line.FindChar(TEXT('#'), CommentStart))
+		{
+			Line.LeftInline(CommentStart);
+		}
+		Line.TrimStartAndEndInline();
+
+		if(!Line.IsEmpty())
+		{
+			OutFingerprints.Add(FCString::Strtoui64(*Line, nullptr, 16));
+		}
+	}
+	return true;
+}
+
+void FValidatorXIssueFilter::Initialize()
+{
+	Suppressions.Reset();
+	Baseline.Reset();
+	bHasBaseline = false;
+
+	LoadFingerprints(FPaths::ProjectConfigDir() / TEXT("ValidatorXSuppressions.txt"), Suppressions);
+
+	FString BaselinePath;
+	if(FParse::Value(FCommandLine::Get(), TEXT("ValidatorXBaseline="), BaselinePath))
+	{
+		bHasBaseline = LoadFingerprints(BaselinePath, Baseline);
+		UE_CLOG(!bHasBaseline, LogTemp, Warning, TEXT("ValidatorX baseline '%s' could not be read, reporting every issue"), *BaselinePath);
+	}
+
+	FParse::Value(FCommandLine::Get(), TEXT("ValidatorXWriteBaseline="), WriteBaselinePath);
+}
+
+bool FValidatorXIssueFilter::ShouldReport(uint64 Fingerprint, TFunctionRef<FString()> Description)
+{
+	if(!WriteBaselinePath.IsEmpty() && !RecordedIssues.Contains(Fingerprint))
+	{
+		RecordedIssues.Add(Fingerprint, Description());
+	}
+
+	if(Suppressions.Contains(Fingerprint) || (bHasBaseline && Baseline.Contains(Fingerprint)))
+	{
+		NumFiltered++;
+		return false;
+	}
+	return true;
+}
+
+bool FValidatorXIssueFilter::AddRecordedIssues(const FString& FilePath)
+{
+	TArray<FString> Lines;
+	if(!FFileHelper::LoadFileToStringArray(Lines, *FilePath))
+	{
+		return false;
+	}
+
+	for(const FString& Line : Lines)
+	{
+		FString FingerprintText;
+		FString Description;
+		if(!Line.Split(TEXT(" # "), &FingerprintText, &Description))
+		{
+			FingerprintText = Line;
+		}
+		FingerprintText.TrimStartAndEndInline();
+
+		if(!FingerprintText.IsEmpty())
+		{
+			RecordedIssues.FindOrAdd(FCString::Strtoui64(*FingerprintText, nullptr, 16), Description);
+		}
+	}
+	return true;
+}
+
+void FValidatorXIssueFilter::WriteBaseline() const
+{
+	if(WriteBaselinePath.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<uint64> Fingerprints;
+	RecordedIssues.GetKeys(Fingerprints);
+	Fingerprints.Sort();
+
+	FString Text;
+	for(const uint64 Fingerprint : Fingerprints)
+	{
+		Text += FString::Printf(TEXT("%016llx # %s") LINE_TERMINATOR, Fingerprint, *RecordedIssues[Fingerprint]);
+	}
+
+	if(!ValidatorX::SaveStringAtomically(Text, WriteBaselinePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write ValidatorX baseline '%s'"), *WriteBaselinePath);
+	}
+}
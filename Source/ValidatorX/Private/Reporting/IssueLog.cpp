@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/IssueLog.h"
+#include "Analysis/SubgraphHasher.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "Logging/MessageLog.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+
+bool FValidatorXIssueLog::IsFormattingMessages() const
+{
+	if(!bFormatMessages.IsSet())
+	{
+		bForceFormatMessages = FParse::Param(FCommandLine::Get(), TEXT("ValidatorXFormatMessages"));
+		bFormatMessages = bForceFormatMessages || (!IsRunningCommandlet() && !FApp::IsUnattended());
+		FParse::Value(FCommandLine::Get(), TEXT("ValidatorXMaxMessages="), MaxFormattedMessages);
+	}
+
+	// Hundreds of thousands of tokenized messages stall the Message Log, the issue browser shows them instead
+	return bFormatMessages.GetValue() && NumFormattingSuspensions == 0 && (bForceFormatMessages || Num() <= MaxFormattedMessages);
+}
+
+void FValidatorXIssueLog::BeginAsset(const UClass* Validator, FName PackageName)
+{
+	ValidatedPackages.Add(PackageName);
+	Table.RemoveAsset(Validator, PackageName);
+}
+
+void FValidatorXIssueLog::Add(const FValidatorXIssue& Issue)
+{
+	Table.Add(Issue);
+}
+
+uint64 FValidatorXIssueLog::GetPackageFingerprint(FName PackageName, int32& OutNumIssues) const
+{
+	TArray<uint64> Fingerprints;
+	Table.ForEachPackageRow(PackageName, [this, &Fingerprints] (int32 Row)
+		{
+			if(Table.GetSeverity(Row) <= EMessageSeverity::Warning)
+			{
+				Fingerprints.Add(Table.GetFingerprint(Row));
+			}
+		});
+
+	OutNumIssues = Fingerprints.Num();
+	Fingerprints.Sort();
+
+	uint64 Fingerprint = 0;
+	for(const uint64 IssueFingerprint : Fingerprints)
+	{
+		Fingerprint = ValidatorX::CombineStableHash(Fingerprint, IssueFingerprint);
+	}
+	return Fingerprint;
+}
+
+void FValidatorXIssueLog::ShowInMessageLog(FName LogName) const
+{
+	FMessageLog MessageLog(LogName);
+	ForEachIssue([&MessageLog] (const FValidatorXIssue& Issue)
+		{
+			MessageLog.AddMessage(MakeMessage(Issue));
+		});
+	MessageLog.Open(EMessageSeverity::Info, true);
+}
+
+TSharedRef<FTokenizedMessage> FValidatorXIssueLog::MakeMessage(const FValidatorXIssue& Issue)
+{
+	const UBlueprintValidatorBase* Validator = Issue.Validator ? Cast<UBlueprintValidatorBase>(Issue.Validator->GetDefaultObject()) : nullptr;
+	if(!Validator)
+	{
+		return FTokenizedMessage::Create(Issue.Severity, FText::FromName(Issue.RuleId));
+	}
+
+	TSharedRef<FTokenizedMessage> Message = FTokenizedMessage::Create(Issue.Severity, Validator->FormatIssue(Issue));
+	Validator->AddIssueTokens(Issue, *Message);
+	return Message;
+}
+
+void FValidatorXIssueLog::Reset()
+{
+	Table.Reset();
+	ValidatedPackages.Reset();
+}
@@ -0,0 +1,323 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/IssueTable.h"
+#include "Misc/PackageName.h"
+
+namespace ValidatorX
+{
+	namespace
+	{
+		/** Removed rows tolerated before the table is compacted, so revalidating a few assets never moves rows */
+		constexpr int32 MinRowsToCompact = 4096;
+	}
+}
+
+FValidatorXIssueTable::FValidatorXIssueTable()
+{
+	ArgOffsets.Add(0);
+}
+
+void FValidatorXIssueTable::Add(const FValidatorXIssue& Issue)
+{
+	const int32 Row = Severities.Num();
+	TArray<int32>& PackageRows = RowsByPackage.FindOrAdd(Issue.PackageName);
+	const int32 FolderIndex = PackageRows.Num() > 0 ? FolderIndices[PackageRows[0]] : FindOrAddFolder(Issue.PackageName);
+	PackageRows.Add(Row);
+
+	Severities.Add(static_cast<uint8>(Issue.Severity));
+	ValidatorIndices.Add(static_cast<uint16>(FindOrAddValidator(Issue.Validator)));
+	FolderIndices.Add(FolderIndex);
+	RuleIds.Add(Issue.RuleId);
+	PackageNames.Add(Issue.PackageName);
+	AssetNames.Add(Issue.AssetName);
+	GraphNames.Add(Issue.GraphName);
+	MemberNames.Add(Issue.MemberName);
+	NodeGuids.Add(Issue.NodeGuid);
+	Fingerprints.Add(Issue.Fingerprint);
+	ArgPool.Append(Issue.Args);
+	ArgOffsets.Add(ArgPool.Num());
+	RemovedRows.Add(false);
+}
+
+int32 FValidatorXIssueTable::RemoveAsset(const UClass* Validator, FName PackageName)
+{
+	TArray<int32>* PackageRows = RowsByPackage.Find(PackageName);
+	const int32* ValidatorIndex = ValidatorIndexByClass.Find(Validator);
+	if(!PackageRows || !ValidatorIndex)
+	{
+		return 0;
+	}
+
+	const int32 NumRemoved = PackageRows->RemoveAll([this, ValidatorIndex] (int32 Row)
+		{
+			if(ValidatorIndices[Row] != *ValidatorIndex)
+			{
+				return false;
+			}
+			RemovedRows[Row] = true;
+			return true;
+		});
+	if(PackageRows->IsEmpty())
+	{
+		RowsByPackage.Remove(PackageName);
+	}
+
+	NumRemovedRows += NumRemoved;
+	if(NumRemovedRows >= ValidatorX::MinRowsToCompact && NumRemovedRows * 2 > NumRows())
+	{
+		Compact();
+	}
+	return NumRemoved;
+}
+
+void FValidatorXIssueTable::Compact()
+{
+	auto CompactColumn = [this] (auto& Column)
+		{
+			int32 NumKept = 0;
+			for(int32 Row = 0; Row < Column.Num(); ++Row)
+			{
+				if(!RemovedRows[Row])
+				{
+					Column[NumKept++] = MoveTemp(Column[Row]);
+				}
+			}
+			Column.SetNum(NumKept);
+		};
+
+	TArray<int32> NewRows;
+	NewRows.SetNumUninitialized(NumRows());
+	TArray<int32> NewArgOffsets;
+	NewArgOffsets.Reserve(Num() + 1);
+	NewArgOffsets.Add(0);
+	TArray<FValidatorXIssueArg> NewArgPool;
+	for(int32 Row = 0; Row < NumRows(); ++Row)
+	{
+		if(RemovedRows[Row])
+		{
+			NewRows[Row] = INDEX_NONE;
+			continue;
+		}
+
+		NewRows[Row] = NewArgOffsets.Num() - 1;
+		for(int32 ArgIndex = ArgOffsets[Row]; ArgIndex < ArgOffsets[Row + 1]; ++ArgIndex)
+		{
+			NewArgPool.Add(MoveTemp(ArgPool[ArgIndex]));
+		}
+		NewArgOffsets.Add(NewArgPool.Num());
+	}
+	ArgPool = MoveTemp(NewArgPool);
+	ArgOffsets = MoveTemp(NewArgOffsets);
+
+	CompactColumn(ValidatorIndices);
+	CompactColumn(FolderIndices);
+	CompactColumn(RuleIds);
+	CompactColumn(PackageNames);
+	CompactColumn(AssetNames);
+	CompactColumn(GraphNames);
+	CompactColumn(MemberNames);
+	CompactColumn(NodeGuids);
+	CompactColumn(Fingerprints);
+	CompactColumn(Severities);
+
+	for(TPair<FName, TArray<int32>>& Pair : RowsByPackage)
+	{
+		for(int32& Row : Pair.Value)
+		{
+			Row = NewRows[Row];
+		}
+	}
+
+	RemovedRows.Init(false, Severities.Num());
+	NumRemovedRows = 0;
+	LayoutVersion++;
+}
+
+void FValidatorXIssueTable::Reset()
+{
+	Severities.Reset();
+	ValidatorIndices.Reset();
+	FolderIndices.Reset();
+	RuleIds.Reset();
+	PackageNames.Reset();
+	AssetNames.Reset();
+	GraphNames.Reset();
+	MemberNames.Reset();
+	NodeGuids.Reset();
+	Fingerprints.Reset();
+	ArgOffsets.Reset();
+	ArgOffsets.Add(0);
+	ArgPool.Reset();
+	RemovedRows.Reset();
+	NumRemovedRows = 0;
+	RowsByPackage.Reset();
+	ValidatorClasses.Reset();
+	ValidatorIndexByClass.Reset();
+	Folders.Reset();
+	FolderIndexByName.Reset();
+	LayoutVersion++;
+}
+
+int32 FValidatorXIssueTable::FindOrAddValidator(const UClass* Validator)
+{
+	if(const int32* Index = ValidatorIndexByClass.Find(Validator))
+	{
+		return *Index;
+	}
+	return ValidatorIndexByClass.Add(Validator, ValidatorClasses.Add(Validator));
+}
+
+int32 FValidatorXIssueTable::FindOrAddFolder(FName PackageName)
+{
+	const FName Folder(*FPackageName::GetLongPackagePath(PackageName.ToString()));
+	if(const int32* Index = FolderIndexByName.Find(Folder))
+	{
+		return *Index;
+	}
+	return FolderIndexByName.Add(Folder, Folders.Add(Folder));
+}
+
+FValidatorXIssue FValidatorXIssueTable::GetIssue(int32 Row) const
+{
+	FValidatorXIssue Issue;
+	Issue.RuleId = RuleIds[Row];
+	Issue.Severity = GetSeverity(Row);
+	Issue.Validator = GetValidator(Row);
+	Issue.PackageName = PackageNames[Row];
+	Issue.AssetName = AssetNames[Row];
+	Issue.GraphName = GraphNames[Row];
+	Issue.MemberName = MemberNames[Row];
+	Issue.NodeGuid = NodeGuids[Row];
+	Issue.Fingerprint = Fingerprints[Row];
+	for(int32 ArgIndex = ArgOffsets[Row]; ArgIndex < ArgOffsets[Row + 1]; ++ArgIndex)
+	{
+		Issue.Args.Add(ArgPool[ArgIndex]);
+	}
+	return Issue;
+}
+
+void FValidatorXIssueTable::ForEachIssue(TFunctionRef<void(const FValidatorXIssue&)> Callback) const
+{
+	for(int32 Row = 0; Row < NumRows(); ++Row)
+	{
+		if(!RemovedRows[Row])
+		{
+			Callback(GetIssue(Row));
+		}
+	}
+}
+
+void FValidatorXIssueTable::ForEachPackageRow(FName PackageName, TFunctionRef<void(int32)> Callback) const
+{
+	if(const TArray<int32>* PackageRows = RowsByPackage.Find(PackageName))
+	{
+		for(const int32 Row : *PackageRows)
+		{
+			Callback(Row);
+		}
+	}
+}
+
+FValidatorXIssueTable::FFacets FValidatorXIssueTable::MakeAllFacets() const
+{
+	FFacets Facets;
+	Facets.Severities.Init(true, NumSeverities);
+	Facets.Validators.Init(true, ValidatorClasses.Num());
+	Facets.Folders.Init(true, Folders.Num());
+	return Facets;
+}
+
+void FValidatorXIssueTable::Search(const FString& SearchText, const TArray<int32>* PreviousRows, TArray<int32>& OutRows) const
+{
+	OutRows.Reset();
+	if(SearchText.IsEmpty() && !PreviousRows)
+	{
+		OutRows.Reserve(Num());
+		for(int32 Row = 0; Row < NumRows(); ++Row)
+		{
+			if(!RemovedRows[Row])
+			{
+				OutRows.Add(Row);
+			}
+		}
+		return;
+	}
+
+	// Thousands of issues share a few hundred packages and rules, match every distinct name once
+	TMap<FName, bool> MatchedNames;
+	auto NameMatches = [&MatchedNames, &SearchText] (FName Name)
+		{
+			if(Name.IsNone())
+			{
+				return false;
+			}
+			if(const bool* bMatched = MatchedNames.Find(Name))
+			{
+				return *bMatched;
+			}
+			return MatchedNames.Add(Name, Name.ToString().Contains(SearchText, ESearchCase::IgnoreCase));
+		};
+
+	auto RowMatches = [&] (int32 Row)
+		{
+			return !RemovedRows[Row] && (SearchText.IsEmpty() || NameMatches(PackageNames[Row]) || NameMatches(GraphNames[Row]) || NameMatches(MemberNames[Row]) || NameMatches(RuleIds[Row]));
+		};
+
+	if(PreviousRows)
+	{
+		for(const int32 Row : *PreviousRows)
+		{
+			if(RowMatches(Row))
+			{
+				OutRows.Add(Row);
+			}
+		}
+	}
+	else
+	{
+		for(int32 Row = 0; Row < NumRows(); ++Row)
+		{
+			if(RowMatches(Row))
+			{
+				OutRows.Add(Row);
+			}
+		}
+	}
+}
+
+void FValidatorXIssueTable::ApplyFacets(const TArray<int32>& Rows, const FFacets& Facets, TArray<int32>& OutRows) const
+{
+	OutRows.Reset(Rows.Num());
+	for(const int32 Row : Rows)
+	{
+		if(Facets.Severities[Severities[Row]] && Facets.Validators[ValidatorIndices[Row]] && Facets.Folders[FolderIndices[Row]])
+		{
+			OutRows.Add(Row);
+		}
+	}
+}
+
+void FValidatorXIssueTable::CountFacets(const TArray<int32>& Rows, TArray<int32>& OutSeverities, TArray<int32>& OutValidators, TArray<int32>& OutFolders) const
+{
+	OutSeverities.Init(0, NumSeverities);
+	OutValidators.Init(0, ValidatorClasses.Num());
+	OutFolders.Init(0, Folders.Num());
+	for(const int32 Row : Rows)
+	{
+		OutSeverities[Severities[Row]]++;
+		OutValidators[ValidatorIndices[Row]]++;
+		OutFolders[FolderIndices[Row]]++;
+	}
+}
+
+SIZE_T FValidatorXIssueTable::GetAllocatedSize() const
+{
+	return Severities.GetAllocatedSize() + ValidatorIndices.GetAllocatedSize() + FolderIndices.GetAllocatedSize()
+		+ RuleIds.GetAllocatedSize() + PackageNames.GetAllocatedSize() + AssetNames.GetAllocatedSize()
+		+ GraphNames.GetAllocatedSize() + MemberNames.GetAllocatedSize() + NodeGuids.GetAllocatedSize()
+		+ Fingerprints.GetAllocatedSize() + ArgOffsets.GetAllocatedSize() + ArgPool.GetAllocatedSize()
+		+ RemovedRows.GetAllocatedSize() + RowsByPackage.GetAllocatedSize()
+		+ ValidatorClasses.GetAllocatedSize() + ValidatorIndexByClass.GetAllocatedSize()
+		+ Folders.GetAllocatedSize() + FolderIndexByName.GetAllocatedSize();
+}
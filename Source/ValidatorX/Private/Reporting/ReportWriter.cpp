@@ -0,0 +1,460 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/ReportWriter.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "HAL/FileManager.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "Reporting/IssueLog.h"
+#include "Reporting/ValidatorStats.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogValidatorXReport, Log, All);
+
+namespace ValidatorX
+{
+	namespace
+	{
+		FString EscapeJson(const FString& Value)
+		{
+			FString Escaped;
+			Escaped.Reserve(Value.Len() + 8);
+			for(const TCHAR Char : Value)
+			{
+				switch(Char)
+				{
+				case TEXT('"'):  Escaped += TEXT("\\\""); break;
+				case TEXT('\\'): Escaped += TEXT("\\\\"); break;
+				case TEXT('\n'): Escaped += TEXT("\\n"); break;
+				case TEXT('\r'): Escaped += TEXT("\\r"); break;
+				case TEXT('\t'): Escaped += TEXT("\\t"); break;
+				default:
+					if(Char < 0x20)
+					{
+						Escaped += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+					}
+					else
+					{
+						Escaped.AppendChar(Char);
+					}
+					break;
+				}
+			}
+			return Escaped;
+		}
+
+		FValidatorXReportTiming ReadReportTiming(const FJsonObject& Object)
+		{
+			FValidatorXReportTiming Timing;
+			Timing.Validator = Object.GetStringField(TEXT("validator"));
+			Timing.NumAssets = Object.GetIntegerField(TEXT("assets"));
+			Timing.NumIssues = Object.GetIntegerField(TEXT("issues"));
+			Timing.Seconds = Object.GetNumberField(TEXT("seconds"));
+			return Timing;
+		}
+
+		/** Fields shared by both formats; SARIF keeps them in the properties bag of a result */
+		void ReadReportProperties(const FJsonObject& Object, FValidatorXReportRecord& Record)
+		{
+			Object.TryGetStringField(TEXT("package"), Record.PackageName);
+			Object.TryGetStringField(TEXT("asset"), Record.AssetPath);
+			Object.TryGetStringField(TEXT("graph"), Record.GraphName);
+			Object.TryGetStringField(TEXT("nodeGuid"), Record.NodeGuid);
+			Object.TryGetStringField(TEXT("member"), Record.MemberName);
+			Object.TryGetBoolField(TEXT("fixAvailable"), Record.bHasFix);
+		}
+
+		/** Base of the artifact URIs of SARIF reports, see MakeArtifactUri */
+		const TCHAR* ArtifactUriBaseId = TEXT("PROJECTROOT");
+
+		/** Package file relative to the project directory, e.g. Content/Characters/BP_Hero.uasset */
+		FString MakeArtifactUri(const FString& PackageName)
+		{
+			FString Filename;
+			if(!FPackageName::DoesPackageExist(PackageName, &Filename))
+			{
+				// Deleted or never saved; Blueprints live in .uasset files unless they are levels
+				if(!FPackageName::TryConvertLongPackageNameToFilename(PackageName, Filename, FPackageName::GetAssetPackageExtension()))
+				{
+					return PackageName;
+				}
+			}
+
+			Filename = FPaths::ConvertRelativePathToFull(Filename);
+			FPaths::MakePathRelativeTo(Filename, *FPaths::ConvertRelativePathToFull(FPaths::ProjectDir()));
+			return Filename;
+		}
+
+		/** JSON array of strings */
+		FString MakeJsonStringArray(const TArray<FString>& Values)
+		{
+			FString Array = TEXT("[");
+			for(const FString& Value : Values)
+			{
+				Array += FString::Printf(TEXT("%s\"%s\""), Array.Len() > 1 ? TEXT(",") : TEXT(""), *EscapeJson(Value));
+			}
+			return Array + TEXT("]");
+		}
+
+		void ReadJsonStringArray(const FJsonObject& Object, const TCHAR* FieldName, TArray<FString>& OutValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+			if(Object.TryGetArrayField(FieldName, Values))
+			{
+				for(const TSharedPtr<FJsonValue>& Value : *Values)
+				{
+					OutValues.Add(Value->AsString());
+				}
+			}
+		}
+
+		uint64 ParseReportFingerprint(const FString& Hex)
+		{
+			return FCString::Strtoui64(*Hex, nullptr, 16);
+		}
+
+		const TCHAR* GetReportLevel(EMessageSeverity::Type Severity)
+		{
+			if(Severity <= EMessageSeverity::Error)
+			{
+				return TEXT("error");
+			}
+			return Severity <= EMessageSeverity::Warning ? TEXT("warning") : TEXT("note");
+		}
+	}
+}
+
+FValidatorXReportWriter::~FValidatorXReportWriter()
+{
+	Close();
+}
+
+void FValidatorXReportWriter::InitializeFromCommandLine()
+{
+	FString ReportPath;
+	if(!FParse::Value(FCommandLine::Get(), TEXT("ValidatorXReport="), ReportPath))
+	{
+		return;
+	}
+
+	EValidatorXReportFormat ReportFormat = GetFormatForPath(ReportPath);
+	FString FormatName;
+	if(FParse::Value(FCommandLine::Get(), TEXT("ValidatorXReportFormat="), FormatName))
+	{
+		ReportFormat = FormatName == TEXT("JsonLines") ? EValidatorXReportFormat::JsonLines : EValidatorXReportFormat::Sarif;
+	}
+
+	Open(ReportPath, ReportFormat);
+}
+
+EValidatorXReportFormat FValidatorXReportWriter::GetFormatForPath(const FString& InPath)
+{
+	return FPaths::GetExtension(InPath) == TEXT("jsonl") ? EValidatorXReportFormat::JsonLines : EValidatorXReportFormat::Sarif;
+}
+
+bool FValidatorXReportWriter::Open(const FString& InPath, EValidatorXReportFormat InFormat)
+{
+	Close();
+
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*InPath));
+	if(!Writer)
+	{
+		UE_LOG(LogValidatorXReport, Error, TEXT("Could not open report '%s'"), *InPath);
+		return false;
+	}
+
+	Path = InPath;
+	Format = InFormat;
+	NumIssues = 0;
+	StartTime = FPlatformTime::Seconds();
+	bFormatMessages = FParse::Param(FCommandLine::Get(), TEXT("ValidatorXFormatMessages")) || (!IsRunningCommandlet() && !FApp::IsUnattended());
+	RuleIds.Reset();
+	ArtifactUris.Reset();
+	Timings.Reset();
+
+	if(Format == EValidatorXReportFormat::Sarif)
+	{
+		// Results are streamed, the tool and its rules follow them once all rules are known
+		WriteString(TEXT("{\"version\":\"2.1.0\",\"$schema\":\"https://json.schemastore.org/sarif-2.1.0.json\",\"runs\":[{\"results\":["));
+	}
+
+	UE_LOG(LogValidatorXReport, Display, TEXT("Writing ValidatorX report to '%s'"), *Path);
+	return true;
+}
+
+void FValidatorXReportWriter::WriteIssue(const FValidatorXIssue& Issue)
+{
+	if(!Writer)
+	{
+		return;
+	}
+
+	const UBlueprintValidatorBase* Validator = Issue.Validator ? Cast<UBlueprintValidatorBase>(Issue.Validator->GetDefaultObject()) : nullptr;
+
+	FValidatorXReportRecord Record;
+	Record.RuleId = FString::Printf(TEXT("%s/%s"), *GetNameSafe(Issue.Validator), *Issue.RuleId.ToString());
+	Record.Level = ValidatorX::GetReportLevel(Issue.Severity);
+	Record.PackageName = Issue.PackageName.ToString();
+	Record.AssetPath = Issue.GetAssetPath();
+	Record.GraphName = Issue.GraphName.IsNone() ? FString() : Issue.GraphName.ToString();
+	Record.NodeGuid = Issue.NodeGuid.IsValid() ? Issue.NodeGuid.ToString(EGuidFormats::DigitsWithHyphens) : FString();
+	Record.MemberName = Issue.MemberName.IsNone() ? FString() : Issue.MemberName.ToString();
+	Record.Fingerprint = Issue.Fingerprint;
+	Record.bHasFix = Validator && Validator->HasIssueFix(Issue);
+	for(const FValidatorXIssueArg& Arg : Issue.Args)
+	{
+		Record.Arguments.Add(Arg.ToString());
+	}
+
+	// Formatting every issue is what deferred formatting saves CI runs from, the arguments are enough to rebuild it
+	Record.Message = bFormatMessages && Validator ? Validator->FormatIssue(Issue).ToString() : Issue.RuleId.ToString();
+	WriteRecord(Record);
+}
+
+void FValidatorXReportWriter::WriteRecord(const FValidatorXReportRecord& Record)
+{
+	if(!Writer)
+	{
+		return;
+	}
+
+	if(Format == EValidatorXReportFormat::Sarif)
+	{
+		RuleIds.Add(Record.RuleId);
+
+		const FString* ArtifactUri = ArtifactUris.Find(Record.PackageName);
+		if(!ArtifactUri)
+		{
+			ArtifactUri = &ArtifactUris.Add(Record.PackageName, ValidatorX::MakeArtifactUri(Record.PackageName));
+		}
+
+		const FString& LogicalName = !Record.GraphName.IsEmpty() ? Record.GraphName : FPackageName::GetShortName(Record.PackageName);
+		WriteString(FString::Printf(
+			TEXT("%s{\"ruleId\":\"%s\",\"level\":\"%s\",\"message\":{\"text\":\"%s\",\"arguments\":%s},")
+			TEXT("\"locations\":[{\"physicalLocation\":{\"artifactLocation\":{\"uri\":\"%s\",\"uriBaseId\":\"%s\"}},\"logicalLocations\":[{\"name\":\"%s\",\"fullyQualifiedName\":\"%s:%s\"}]}],")
+			TEXT("\"partialFingerprints\":{\"validatorX/v1\":\"%016llx\"},")
+			TEXT("\"properties\":{\"package\":\"%s\",\"asset\":\"%s\",\"graph\":\"%s\",\"nodeGuid\":\"%s\",\"member\":\"%s\",\"fixAvailable\":%s}}"),
+			NumIssues > 0 ? TEXT(",\n") : TEXT("\n"),
+			*ValidatorX::EscapeJson(Record.RuleId),
+			*Record.Level,
+			*ValidatorX::EscapeJson(Record.Message),
+			*ValidatorX::MakeJsonStringArray(Record.Arguments),
+			*ValidatorX::EscapeJson(*ArtifactUri),
+			ValidatorX::ArtifactUriBaseId,
+			*ValidatorX::EscapeJson(LogicalName),
+			*ValidatorX::EscapeJson(Record.AssetPath),
+			*ValidatorX::EscapeJson(LogicalName),
+			Record.Fingerprint,
+			*ValidatorX::EscapeJson(Record.PackageName),
+			*ValidatorX::EscapeJson(Record.AssetPath),
+			*ValidatorX::EscapeJson(Record.GraphName),
+			*Record.NodeGuid,
+			*ValidatorX::EscapeJson(Record.MemberName),
+			Record.bHasFix ? TEXT("true") : TEXT("false")));
+	}
+	else
+	{
+		WriteString(FString::Printf(
+			TEXT("{\"type\":\"issue\",\"rule\":\"%s\",\"severity\":\"%s\",\"package\":\"%s\",\"asset\":\"%s\",\"graph\":\"%s\",\"nodeGuid\":\"%s\",\"member\":\"%s\",\"fingerprint\":\"%016llx\",\"fixAvailable\":%s,\"args\":%s,\"message\":\"%s\"}\n"),
+			*ValidatorX::EscapeJson(Record.RuleId),
+			*Record.Level,
+			*ValidatorX::EscapeJson(Record.PackageName),
+			*ValidatorX::EscapeJson(Record.AssetPath),
+			*ValidatorX::EscapeJson(Record.GraphName),
+			*Record.NodeGuid,
+			*ValidatorX::EscapeJson(Record.MemberName),
+			Record.Fingerprint,
+			Record.bHasFix ? TEXT("true") : TEXT("false"),
+			*ValidatorX::MakeJsonStringArray(Record.Arguments),
+			*ValidatorX::EscapeJson(Record.Message)));
+	}
+
+	NumIssues++;
+}
+
+void FValidatorXReportWriter::Close()
+{
+	if(!Writer)
+	{
+		return;
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	if(!Timings.IsSet())
+	{
+		TArray<FValidatorXReportTiming>& StatsTimings = Timings.Emplace();
+		for(const TPair<const UClass*, FValidatorXValidatorStats::FEntry>& Pair : FValidatorXValidatorStats::Get().GetSortedEntries())
+		{
+			StatsTimings.Add({ GetNameSafe(Pair.Key), Pair.Value.NumAssets, Pair.Value.NumIssues, Pair.Value.Seconds });
+		}
+	}
+
+	if(Format == EValidatorXReportFormat::Sarif)
+	{
+		FString Rules;
+		for(const FString& RuleId : RuleIds)
+		{
+			Rules += FString::Printf(TEXT("%s{\"id\":\"%s\"}"), Rules.IsEmpty() ? TEXT("") : TEXT(","), *ValidatorX::EscapeJson(RuleId));
+		}
+
+		FString TimingEntries;
+		for(const FValidatorXReportTiming& Timing : Timings.GetValue())
+		{
+			TimingEntries += FString::Printf(TEXT("%s{\"validator\":\"%s\",\"assets\":%d,\"issues\":%d,\"seconds\":%.4f}"),
+				TimingEntries.IsEmpty() ? TEXT("") : TEXT(","),
+				*ValidatorX::EscapeJson(Timing.Validator), Timing.NumAssets, Timing.NumIssues, Timing.Seconds);
+		}
+
+		WriteString(FString::Printf(
+			TEXT("\n],\"originalUriBaseIds\":{\"%s\":{\"description\":{\"text\":\"Project directory\"}}},\"tool\":{\"driver\":{\"name\":\"ValidatorX\",\"informationUri\":\"https://github.com/VaeDeveloper/ValidatorX\",\"rules\":[%s]}},")
+			TEXT("\"invocations\":[{\"executionSuccessful\":true,\"properties\":{\"issues\":%d,\"seconds\":%.2f,\"validatorTimings\":[%s]}}]}]}\n"),
+			ValidatorX::ArtifactUriBaseId, *Rules, NumIssues, TotalSeconds, *TimingEntries));
+	}
+	else
+	{
+		for(const FValidatorXReportTiming& Timing : Timings.GetValue())
+		{
+			WriteString(FString::Printf(TEXT("{\"type\":\"timing\",\"validator\":\"%s\",\"assets\":%d,\"issues\":%d,\"seconds\":%.4f}\n"),
+				*ValidatorX::EscapeJson(Timing.Validator), Timing.NumAssets, Timing.NumIssues, Timing.Seconds));
+		}
+		WriteString(FString::Printf(TEXT("{\"type\":\"summary\",\"issues\":%d,\"seconds\":%.2f}\n"), NumIssues, TotalSeconds));
+	}
+
+	Writer->Close();
+	Writer.Reset();
+	Timings.Reset();
+
+	UE_LOG(LogValidatorXReport, Display, TEXT("%d issues written to '%s'"), NumIssues, *Path);
+}
+
+bool FValidatorXReportWriter::WriteIssueLog(const FString& InPath)
+{
+	FValidatorXReportWriter Report;
+	if(!Report.Open(InPath, GetFormatForPath(InPath)))
+	{
+		return false;
+	}
+
+	FValidatorXIssueLog::Get().ForEachIssue([&Report] (const FValidatorXIssue& Issue)
+		{
+			Report.WriteIssue(Issue);
+		});
+	Report.Close();
+	return true;
+}
+
+void FValidatorXReportWriter::WriteString(const FString& String)
+{
+	const FTCHARToUTF8 Utf8(*String);
+	Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
+
+bool FValidatorXReportWriter::ReadReport(const FString& InPath, TFunctionRef<void(const FValidatorXReportRecord&)> OnRecord, TArray<FValidatorXReportTiming>& OutTimings)
+{
+	if(GetFormatForPath(InPath) == EValidatorXReportFormat::JsonLines)
+	{
+		// Line by line, a shard of a large project holds many issues
+		bool bParsed = true;
+		const bool bRead = FFileHelper::LoadFileToStringWithLineVisitor(*InPath, [&] (FStringView Line)
+			{
+				TSharedPtr<FJsonObject> Object;
+				if(Line.TrimStartAndEnd().IsEmpty() || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Line)), Object) || !Object.IsValid())
+				{
+					bParsed &= Line.TrimStartAndEnd().IsEmpty();
+					return;
+				}
+
+				const FString Type = Object->GetStringField(TEXT("type"));
+				if(Type == TEXT("timing"))
+				{
+					OutTimings.Add(ValidatorX::ReadReportTiming(*Object));
+				}
+				else if(Type == TEXT("issue"))
+				{
+					FValidatorXReportRecord Record;
+					Record.RuleId = Object->GetStringField(TEXT("rule"));
+					Record.Level = Object->GetStringField(TEXT("severity"));
+					Record.PackageName = Object->GetStringField(TEXT("package"));
+					Record.Fingerprint = ValidatorX::ParseReportFingerprint(Object->GetStringField(TEXT("fingerprint")));
+					Record.Message = Object->GetStringField(TEXT("message"));
+					ValidatorX::ReadJsonStringArray(*Object, TEXT("args"), Record.Arguments);
+					ValidatorX::ReadReportProperties(*Object, Record);
+					OnRecord(Record);
+				}
+			});
+		return bRead && bParsed;
+	}
+
+	FString Text;
+	TSharedPtr<FJsonObject> Root;
+	if(!FFileHelper::LoadFileToString(Text, *InPath) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid())
+	{
+		return false;
+	}
+
+	for(const TSharedPtr<FJsonValue>& RunValue : Root->GetArrayField(TEXT("runs")))
+	{
+		const TSharedPtr<FJsonObject> Run = RunValue->AsObject();
+		if(!Run.IsValid()) continue;
+
+		const TArray<TSharedPtr<FJsonValue>>* Results = nullptr;
+		if(Run->TryGetArrayField(TEXT("results"), Results))
+		{
+			for(const TSharedPtr<FJsonValue>& ResultValue : *Results)
+			{
+				const TSharedPtr<FJsonObject> Result = ResultValue->AsObject();
+				if(!Result.IsValid()) continue;
+
+				FValidatorXReportRecord Record;
+				Record.RuleId = Result->GetStringField(TEXT("ruleId"));
+				Record.Level = Result->GetStringField(TEXT("level"));
+
+				const TSharedPtr<FJsonObject>* Message = nullptr;
+				if(Result->TryGetObjectField(TEXT("message"), Message))
+				{
+					Record.Message = (*Message)->GetStringField(TEXT("text"));
+					ValidatorX::ReadJsonStringArray(**Message, TEXT("arguments"), Record.Arguments);
+				}
+
+				const TSharedPtr<FJsonObject>* Fingerprints = nullptr;
+				if(Result->TryGetObjectField(TEXT("partialFingerprints"), Fingerprints))
+				{
+					Record.Fingerprint = ValidatorX::ParseReportFingerprint((*Fingerprints)->GetStringField(TEXT("validatorX/v1")));
+				}
+
+				// The package comes from the properties, the artifact location is the package file
+				const TSharedPtr<FJsonObject>* Properties = nullptr;
+				if(Result->TryGetObjectField(TEXT("properties"), Properties))
+				{
+					ValidatorX::ReadReportProperties(**Properties, Record);
+				}
+				OnRecord(Record);
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* Invocations = nullptr;
+		if(Run->TryGetArrayField(TEXT("invocations"), Invocations))
+		{
+			for(const TSharedPtr<FJsonValue>& InvocationValue : *Invocations)
+			{
+				const TSharedPtr<FJsonObject>* Properties = nullptr;
+				const TArray<TSharedPtr<FJsonValue>>* TimingValues = nullptr;
+				if(InvocationValue->AsObject()->TryGetObjectField(TEXT("properties"), Properties)
+					&& (*Properties)->TryGetArrayField(TEXT("validatorTimings"), TimingValues))
+				{
+					for(const TSharedPtr<FJsonValue>& TimingValue : *TimingValues)
+					{
+						OutTimings.Add(ValidatorX::ReadReportTiming(*TimingValue->AsObject()));
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/ValidationIssue.h"
+#include "BlueprintEditor.h"
+#include "BlueprintEditorModule.h"
+#include "EdGraph/EdGraph.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Containers/Ticker.h"
+#include "Misc/MessageDialog.h"
+#include "SMyBlueprint.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/SoftObjectPath.h"
+
+FFormatArgumentValue FValidatorXIssueArg::ToFormatArgument() const
+{
+	if(const int64* Number = Value.TryGet<int64>())
+	{
+		return FText::AsNumber(*Number);
+	}
+	if(const double* Float = Value.TryGet<double>())
+	{
+		return FText::AsNumber(*Float);
+	}
+	if(const FName* Name = Value.TryGet<FName>())
+	{
+		return FText::FromName(*Name);
+	}
+	if(const FString* String = Value.TryGet<FString>())
+	{
+		return FText::FromString(*String);
+	}
+	if(const FGuid* Guid = Value.TryGet<FGuid>())
+	{
+		return FText::FromString(Guid->ToString(EGuidFormats::DigitsWithHyphens));
+	}
+	return FText::AsMemory(Value.Get<FBytes>().Value);
+}
+
+FString FValidatorXIssueArg::ToString() const
+{
+	if(const int64* Number = Value.TryGet<int64>())
+	{
+		return LexToString(*Number);
+	}
+	if(const double* Float = Value.TryGet<double>())
+	{
+		return LexToString(*Float);
+	}
+	if(const FName* Name = Value.TryGet<FName>())
+	{
+		return Name->ToString();
+	}
+	if(const FString* String = Value.TryGet<FString>())
+	{
+		return *String;
+	}
+	if(const FGuid* Guid = Value.TryGet<FGuid>())
+	{
+		return Guid->ToString(EGuidFormats::DigitsWithHyphens);
+	}
+	return LexToString(Value.Get<FBytes>().Value);
+}
+
+FString FValidatorXIssue::GetAssetPath() const
+{
+	return FString::Printf(TEXT("%s.%s"), *PackageName.ToString(), *AssetName.ToString());
+}
+
+FString FValidatorXIssue::GetLocator() const
+{
+	FString Locator;
+	if(NodeGuid.IsValid())
+	{
+		Locator = NodeGuid.ToString(EGuidFormats::Digits);
+	}
+	else if(!GraphName.IsNone())
+	{
+		Locator = GraphName.ToString();
+	}
+
+	if(!MemberName.IsNone())
+	{
+		Locator += Locator.IsEmpty() ? MemberName.ToString() : TEXT(".") + MemberName.ToString();
+	}
+	return Locator;
+}
+
+UObject* FValidatorXIssue::FindAsset() const
+{
+	return FSoftObjectPath(GetAssetPath()).ResolveObject();
+}
+
+UObject* FValidatorXIssue::LoadAsset() const
+{
+	return FSoftObjectPath(GetAssetPath()).TryLoad();
+}
+
+UEdGraphNode* FValidatorXIssue::FindNode() const
+{
+	if(UEdGraphNode* LoadedNode = Node.Get())
+	{
+		return LoadedNode;
+	}
+
+	const UBlueprint* Blueprint = Cast<UBlueprint>(FindAsset());
+	if(!Blueprint || !NodeGuid.IsValid())
+	{
+		return nullptr;
+	}
+
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+	for(const UEdGraph* Graph : AllGraphs)
+	{
+		if(!Graph) continue;
+
+		for(UEdGraphNode* GraphNode : Graph->Nodes)
+		{
+			if(GraphNode && GraphNode->NodeGuid == NodeGuid)
+			{
+				return GraphNode;
+			}
+		}
+	}
+	return nullptr;
+}
+
+UEdGraph* FValidatorXIssue::FindGraph() const
+{
+	if(const UEdGraphNode* GraphNode = FindNode())
+	{
+		return GraphNode->GetGraph();
+	}
+
+	const UBlueprint* Blueprint = Cast<UBlueprint>(FindAsset());
+	if(!Blueprint || GraphName.IsNone())
+	{
+		return nullptr;
+	}
+
+	TArray<UEdGraph*> AllGraphs;
+	Blueprint->GetAllGraphs(AllGraphs);
+	UEdGraph* const* Found = AllGraphs.FindByPredicate([this] (const UEdGraph* Graph) { return Graph && Graph->GetFName() == GraphName; });
+	return Found ? *Found : nullptr;
+}
+
+FText FValidatorXIssue::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+	if(const UEdGraphNode* GraphNode = FindNode())
+	{
+		return GraphNode->GetNodeTitle(TitleType);
+	}
+	return FText::FromString(NodeGuid.ToString());
+}
+
+namespace ValidatorX
+{
+	void JumpToIssue(const FValidatorXIssue& Issue)
+	{
+		UBlueprint* Blueprint = Cast<UBlueprint>(Issue.LoadAsset());
+		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+		if(!Blueprint || !AssetEditorSubsystem)
+		{
+			return;
+		}
+
+		AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
+		IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false);
+		if(!EditorInstance)
+		{
+			return;
+		}
+
+		FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance);
+		if(UEdGraphNode* Node = Issue.FindNode())
+		{
+			if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Node->GetGraph(), true))
+			{
+				GraphEditor->JumpToNode(Node, false);
+			}
+		}
+		else
+		{
+			// Local variables are only listed while their function graph is open
+			if(UEdGraph* Graph = Issue.FindGraph())
+			{
+				BlueprintEditor->OpenGraphAndBringToFront(Graph, true);
+			}
+
+			if(!Issue.MemberName.IsNone())
+			{
+				if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
+				{
+					MyBlueprintWidget->SelectItemByName(Issue.MemberName, ESelectInfo::Direct, INDEX_NONE, false);
+				}
+			}
+		}
+	}
+
+	TSharedRef<IMessageToken> MakeJumpToIssueToken(const FValidatorXIssue& Issue)
+	{
+		FText JumpText = INVTEXT("Jump to asset");
+		if(Issue.NodeGuid.IsValid())
+		{
+			JumpText = INVTEXT("Jump to node");
+		}
+		else if(!Issue.MemberName.IsNone())
+		{
+			JumpText = FText::Format(INVTEXT("Jump to '{0}'"), Issue.GetMemberText());
+		}
+		else if(!Issue.GraphName.IsNone())
+		{
+			JumpText = FText::Format(INVTEXT("Jump to '{0}'"), Issue.GetGraphText());
+		}
+
+		return FActionToken::Create(JumpText, FText::GetEmpty(), FSimpleDelegate::CreateLambda([Issue]
+			{
+				ValidatorX::JumpToIssue(Issue);
+			}));
+	}
+
+	TSharedRef<IMessageToken> MakeFixIssueToken(const FValidatorXIssue& Issue, const FText& FixText, const FText& ConfirmText, TFunction<void(UBlueprint*)> Fix)
+	{
+		return FActionToken::Create(FixText, FText::GetEmpty(), FSimpleDelegate::CreateLambda([Issue, ConfirmText, Fix]
+			{
+				UBlueprint* Blueprint = Cast<UBlueprint>(Issue.LoadAsset());
+				UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+				if(!Blueprint || !AssetEditorSubsystem)
+				{
+					return;
+				}
+
+				AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
+
+				// Ask on the next tick, once the editor is up
+				FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakBlueprint = TWeakObjectPtr<UBlueprint>(Blueprint), ConfirmText, Fix] (float DeltaTime)
+					{
+						if(UBlueprint* LoadedBlueprint = WeakBlueprint.Get())
+						{
+							if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
+							{
+								Fix(LoadedBlueprint);
+							}
+						}
+						return false;
+					}));
+			}));
+	}
+}
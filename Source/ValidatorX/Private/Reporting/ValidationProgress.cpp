@@ -0,0 +1,31 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/ValidationProgress.h"
+
+FValidatorXValidationProgress::FValidatorXValidationProgress(int32 InNumAssets)
+	: NumAssets(InNumAssets)
+	, StartTime(FPlatformTime::Seconds())
+{
+}
+
+void FValidatorXValidationProgress::AddAsset(int32 NumAssetNodes)
+{
+	NumDone++;
+	NumNodes += FMath::Max(NumAssetNodes, 0);
+}
+
+double FValidatorXValidationProgress::GetSecondsLeft() const
+{
+	return NumDone > 0 ? (FPlatformTime::Seconds() - StartTime) / NumDone * (NumAssets - NumDone) : 0.0;
+}
+
+FText FValidatorXValidationProgress::GetText() const
+{
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_SMALL_NUMBER);
+	return FText::Format(INVTEXT("{0} / {1} Blueprints, {2} nodes/s, {3} left"),
+		FText::AsNumber(NumDone),
+		FText::AsNumber(NumAssets),
+		FText::AsNumber(FMath::RoundToInt64(NumNodes / Elapsed)),
+		FText::AsTimespan(FTimespan::FromSeconds(FMath::RoundToDouble(GetSecondsLeft()))));
+}
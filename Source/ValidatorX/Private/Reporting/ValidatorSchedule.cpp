@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/ValidatorSchedule.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ValidatorXStateFiles.h"
+
+namespace ValidatorX
+{
+	static const TCHAR* ValidatorScheduleHeader = TEXT("Validator,Assets,Hits,Seconds");
+}
+
+void FValidatorXValidatorSchedule::AddValidation(const UClass* Validator, double Seconds, bool bHit)
+{
+	if(!Validator)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries.FindOrAdd(Validator->GetFName());
+	Entry.NumAssets++;
+	Entry.NumHits += bHit ? 1 : 0;
+	Entry.Seconds += Seconds;
+	bDirty = true;
+}
+
+const FValidatorXValidatorSchedule::FEntry* FValidatorXValidatorSchedule::Find(const UClass* Validator) const
+{
+	return Validator ? Entries.Find(Validator->GetFName()) : nullptr;
+}
+
+double FValidatorXValidatorSchedule::GetPriority(const UClass* Validator) const
+{
+	// One imaginary asset with a hit in two and one millisecond of cost
+	const FEntry* Entry = Find(Validator);
+	const double HitRate = Entry ? (Entry->NumHits + 1.0) / (Entry->NumAssets + 2.0) : 0.5;
+	const double AverageMs = Entry ? (Entry->Seconds * 1000.0 + 1.0) / (Entry->NumAssets + 1.0) : 1.0;
+	return HitRate / AverageMs;
+}
+
+bool FValidatorXValidatorSchedule::IsExpensive(const UBlueprintValidatorBase* Validator) const
+{
+	if(!Validator)
+	{
+		return false;
+	}
+
+	const FEntry* Entry = Find(Validator->GetClass());
+	return Validator->IsExpensive() || (Entry && Entry->GetAverageMs() > ExpensiveMs);
+}
+
+FString FValidatorXValidatorSchedule::GetFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ValidatorX") / TEXT("ValidatorSchedule.csv");
+}
+
+void FValidatorXValidatorSchedule::Load()
+{
+	Entries.Reset();
+	bDirty = false;
+	bFailFast = FParse::Param(FCommandLine::Get(), TEXT("ValidatorXFailFast"));
+
+	TArray<FString> Lines;
+	if(!FFileHelper::LoadFileToStringArray(Lines, *GetFilePath()))
+	{
+		return;
+	}
+
+	TArray<FString> Columns;
+	for(const FString& Line : Lines)
+	{
+		Columns.Reset();
+		Line.ParseIntoArray(Columns, TEXT(","), false);
+		if(Columns.Num() != 4 || !Columns[1].IsNumeric())
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.FindOrAdd(FName(*Columns[0]));
+		LexFromString(Entry.NumAssets, *Columns[1]);
+		LexFromString(Entry.NumHits, *Columns[2]);
+		LexFromString(Entry.Seconds, *Columns[3]);
+	}
+}
+
+void FValidatorXValidatorSchedule::Save()
+{
+	if(!bDirty || !ValidatorX::IsPersistingState())
+	{
+		return;
+	}
+
+	FString Text = FString(ValidatorX::ValidatorScheduleHeader) + LINE_TERMINATOR;
+	for(const TPair<FName, FEntry>& Pair : Entries)
+	{
+		Text += FString::Printf(TEXT("%s,%d,%d,%.6f") LINE_TERMINATOR, *Pair.Key.ToString(), Pair.Value.NumAssets, Pair.Value.NumHits, Pair.Value.Seconds);
+	}
+
+	if(ValidatorX::SaveStringAtomically(Text, GetFilePath()))
+	{
+		bDirty = false;
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Could not write validator schedule '%s'"), *GetFilePath());
+	}
+}
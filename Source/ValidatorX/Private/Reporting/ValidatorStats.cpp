@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Reporting/ValidatorStats.h"
+#include "Reporting/ValidatorSchedule.h"
+
+void FValidatorXValidatorStats::AddValidation(const UClass* Validator, double Seconds, bool bHit)
+{
+	FEntry& Entry = Entries.FindOrAdd(Validator);
+	Entry.NumAssets++;
+	Entry.Seconds += Seconds;
+
+	FValidatorXValidatorSchedule::Get().AddValidation(Validator, Seconds, bHit);
+}
+
+void FValidatorXValidatorStats::AddIssue(const UClass* Validator, bool bIsProblem)
+{
+	FEntry& Entry = Entries.FindOrAdd(Validator);
+	Entry.NumIssues++;
+	Entry.NumProblems += bIsProblem ? 1 : 0;
+}
+
+TArray<TPair<const UClass*, FValidatorXValidatorStats::FEntry>> FValidatorXValidatorStats::GetSortedEntries() const
+{
+	TArray<TPair<const UClass*, FEntry>> Sorted = Entries.Array();
+	Sorted.Sort([] (const TPair<const UClass*, FEntry>& A, const TPair<const UClass*, FEntry>& B) { return A.Value.Seconds > B.Value.Seconds; });
+	return Sorted;
+}
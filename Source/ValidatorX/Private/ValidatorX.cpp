@@ -1,9 +1,31 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ValidatorX.h"
+#include "ValidatorXBackgroundScan.h"
+#include "ValidatorXConfigManager.h"
 #include "ValidatorXManager.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/CompileProfiler.h"
+#include "Analysis/DependencySizeCache.h"
+#include "Analysis/SubgraphHashTable.h"
+#include "Reporting/IssueFilter.h"
+#include "Reporting/IssueLog.h"
+#include "Reporting/ReportWriter.h"
+#include "Reporting/ValidationProgress.h"
+#include "Reporting/ValidatorSchedule.h"
 #include "Widgets/SValidatorWidget.h"
 #include "EditorValidatorSubsystem.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "ContentBrowserMenuContexts.h"
+#include "ContentBrowserModule.h"
+#include "Engine/Blueprint.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "IContentBrowserSingleton.h"
+#include "Logging/MessageLog.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DataValidation.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Widgets/Notifications/SNotificationList.h"
 
 #include "Layout/WidgetPath.h"
 DEFINE_LOG_CATEGORY_STATIC(LogValidatorX, All, All);
@@ -22,6 +44,15 @@ void FValidatorXModule::StartupModule()
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(ValidatorXTabName, FOnSpawnTab::CreateRaw(this, &FValidatorXModule::OnSpawnValidatorXTab))
      .SetDisplayName(NSLOCTEXT("ValidatorX", "TabTitle", "ValidatorX"))
      .SetMenuType(ETabSpawnerMenuType::Hidden);
+
+	// Counts read by the registry-only checks of the validators, written whenever a Blueprint is saved
+	ValidatorX::RegisterAssetTags();
+
+	// Registry sizes and dependencies change when packages are saved, drop the memoised closures
+	PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddLambda([] (const FString&, UPackage*, FObjectPostSaveContext)
+		{
+			FValidatorXDependencyCache::Get().Reset();
+		});
 }
 
 void FValidatorXModule::RegisterMenus()
@@ -36,11 +67,206 @@ void FValidatorXModule::RegisterMenus()
 			LOCTEXT("OpenValidatorXTooltip", "Opens the ValidatorX tool window."),
 			FSlateIcon(FSlateIcon(FName("EditorStyle"), "Icons.Validate")),
 			FUIAction(FExecuteAction::CreateRaw(this, &FValidatorXModule::OpenManagerTab))));
+		Section.AddEntry(FToolMenuEntry::InitMenuEntry(
+			"ValidatorXProfileCompile",
+			LOCTEXT("ProfileCompileTimes", "Profile Blueprint Compile Times"),
+			LOCTEXT("ProfileCompileTimesTooltip", "Compiles the Blueprints selected in the Content Browser with timing and records the results for the compile time validator."),
+			FSlateIcon(FName("EditorStyle"), "Kismet.Status.Good"),
+			FUIAction(FExecuteAction::CreateRaw(this, &FValidatorXModule::ProfileSelectedBlueprints))));
+		Section.AddEntry(FToolMenuEntry::InitMenuEntry(
+			"ValidatorXValidateSelected",
+			LOCTEXT("ValidateSelected", "Validate Selected Blueprints"),
+			LOCTEXT("ValidateSelectedTooltip", "Runs the validators enabled in the ValidatorX tab on the Blueprints selected in the Content Browser."),
+			FSlateIcon(FName("EditorStyle"), "Icons.Validate"),
+			FUIAction(FExecuteAction::CreateRaw(this, &FValidatorXModule::ValidateSelectedBlueprints))));
+
+		UToolMenu* FolderMenu = UToolMenus::Get()->ExtendMenu("ContentBrowser.FolderContextMenu");
+		FolderMenu->FindOrAddSection("PathContextBulkOperations").AddDynamicEntry("ValidatorXValidateFolder", FNewToolMenuSectionDelegate::CreateLambda([this] (FToolMenuSection& InSection)
+			{
+				const UContentBrowserFolderContext* Context = InSection.FindContext<UContentBrowserFolderContext>();
+				if(!Context || Context->GetSelectedPackagePaths().Num() == 0)
+				{
+					return;
+				}
+				InSection.AddMenuEntry(
+					"ValidatorXValidateFolder",
+					LOCTEXT("ValidateFolder", "Validate with ValidatorX"),
+					LOCTEXT("ValidateFolderTooltip", "Runs the validators enabled in the ValidatorX tab on every Blueprint in the selected folders."),
+					FSlateIcon(FName("EditorStyle"), "Icons.Validate"),
+					FUIAction(FExecuteAction::CreateRaw(this, &FValidatorXModule::ValidateFolders, Context->GetSelectedPackagePaths())));
+			}));
+	}
+}
+
+void FValidatorXModule::ProfileSelectedBlueprints()
+{
+	TArray<FAssetData> SelectedAssets;
+	FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser").Get().GetSelectedAssets(SelectedAssets);
+
+	FValidatorXCompileProfiler& Profiler = FValidatorXCompileProfiler::Get();
+	TArray<FValidatorXCompileSample> Samples;
+	for(const FAssetData& AssetData : SelectedAssets)
+	{
+		if(UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+		{
+			Samples.Add(Profiler.ProfileBlueprint(Blueprint));
+		}
+	}
+	Profiler.Flush();
+
+	Samples.Sort([] (const FValidatorXCompileSample& A, const FValidatorXCompileSample& B) { return A.CompileMs > B.CompileMs; });
+
+	FMessageLog MessageLog("AssetCheck");
+	MessageLog.NewPage(LOCTEXT("CompileProfilePage", "ValidatorX compile profile"));
+	for(const FValidatorXCompileSample& Sample : Samples)
+	{
+		MessageLog.Info(FText::Format(
+			LOCTEXT("CompileProfileSample", "{0}: {1} ms ({2} graphs, {3} nodes, {4} macro instances)"),
+			FText::FromName(Sample.PackageName),
+			FText::AsNumber(FMath::RoundToInt(Sample.CompileMs)),
+			FText::AsNumber(Sample.Metrics.NumGraphs),
+			FText::AsNumber(Sample.Metrics.NumNodes),
+			FText::AsNumber(Sample.Metrics.NumMacroInstances)));
+	}
+	if(Samples.Num() > 1)
+	{
+		MessageLog.Info(FText::Format(LOCTEXT("CompileProfileCorrelation", "Correlation of compile time with {0}"),
+			FText::FromString(FValidatorXCompileProfiler::DescribeCorrelations(Samples))));
+	}
+	MessageLog.Open(EMessageSeverity::Info, true);
+}
+
+void FValidatorXModule::ValidateSelectedBlueprints()
+{
+	TArray<FAssetData> SelectedAssets;
+	FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser").Get().GetSelectedAssets(SelectedAssets);
+	ValidateAssets(MoveTemp(SelectedAssets));
+}
+
+void FValidatorXModule::ValidateFolders(TArray<FString> PackagePaths)
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	for(const FString& PackagePath : PackagePaths)
+	{
+		Filter.PackagePaths.Add(FName(*PackagePath));
+	}
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> Assets;
+	IAssetRegistry::GetChecked().GetAssets(Filter, Assets);
+	Assets.Sort([] (const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+	ValidateAssets(MoveTemp(Assets));
+}
+
+void FValidatorXModule::ValidateAssets(TArray<FAssetData> Assets)
+{
+	TArray<UBlueprintValidatorBase*> EnabledValidators;
+	for(const TWeakObjectPtr<UBlueprintValidatorBase>& Validator : FValidatorXManager::Get().GetValidators())
+	{
+		if(Validator.IsValid() && Validator->IsEnabled())
+		{
+			EnabledValidators.Add(Validator.Get());
+		}
+	}
+
+	// Cheap validators likely to find something first, they matter most when the run is cancelled
+	FValidatorXValidatorSchedule::Get().SortValidators(EnabledValidators);
+
+	// Nothing to load for assets no enabled validator can have findings on
+	Assets.RemoveAll([&EnabledValidators] (const FAssetData& AssetData)
+		{
+			return !EnabledValidators.ContainsByPredicate([&AssetData] (const UBlueprintValidatorBase* Validator) { return Validator->CanValidateAssetData(AssetData); });
+		});
+
+	if(Assets.Num() == 0)
+	{
+		FNotificationInfo Info(EnabledValidators.Num() == 0
+			? LOCTEXT("NoValidatorEnabled", "No ValidatorX validator is enabled, enable some in the ValidatorX tab")
+			: LOCTEXT("NothingToValidate", "No Blueprint to validate"));
+		Info.ExpireDuration = 5.0f;
+		FSlateNotificationManager::Get().AddNotification(Info);
+		return;
+	}
+
+	FValidatorXValidationProgress Progress(Assets.Num());
+	int32 NumInvalid = 0;
+	int32 NumSinceCollect = 0;
+	bool bCancelled = false;
+	{
+		FScopedSlowTask SlowTask(Assets.Num(), LOCTEXT("ValidatingBlueprints", "Validating Blueprints with ValidatorX"));
+		SlowTask.MakeDialog(true);
+
+		// Results go to the issue log and the Issues panel, nobody reads the context
+		const FValidatorXIssueLog::FSuspendFormattingScope SuspendFormatting;
+
+		for(const FAssetData& AssetData : Assets)
+		{
+			SlowTask.EnterProgressFrame(1.0f, Progress.GetText());
+			if(SlowTask.ShouldCancel())
+			{
+				bCancelled = true;
+				break;
+			}
+
+			UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+			if(!Blueprint)
+			{
+				Progress.AddAsset(0);
+				continue;
+			}
+
+			FDataValidationContext Context(false, EDataValidationUsecase::Manual, {});
+			bool bIsInvalid = false;
+			for(UBlueprintValidatorBase* Validator : EnabledValidators)
+			{
+				// A validator is one pass over the graphs, the finest point a large asset can stop at
+				if(SlowTask.ShouldCancel())
+				{
+					bCancelled = true;
+					break;
+				}
+				bIsInvalid |= Validator->RunValidation(AssetData, Blueprint, Context) == EDataValidationResult::Invalid;
+			}
+			NumInvalid += bIsInvalid ? 1 : 0;
+			// Registry tag of the last save, walking the graphs again only for a throughput figure would cost a validator pass
+			Progress.AddAsset(ValidatorX::GetAssetTagCount(AssetData, ValidatorX::AssetTags::NumNodes));
+
+			if(bCancelled)
+			{
+				break;
+			}
+			if(++NumSinceCollect >= 200)
+			{
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+				NumSinceCollect = 0;
+			}
+		}
 	}
+
+	// Partial results are as good as complete ones for the assets they cover
+	FValidatorXSubgraphHashTable::Get().Save();
+	FValidatorXValidatorSchedule::Get().Save();
+
+	FNotificationInfo Info(FText::Format(bCancelled
+			? LOCTEXT("ValidationCancelled", "Validation cancelled after {0} of {1} Blueprints, {2} with issues")
+			: LOCTEXT("ValidationDone", "{0} of {1} Blueprints validated, {2} with issues"),
+		FText::AsNumber(Progress.GetNumDone()), FText::AsNumber(Assets.Num()), FText::AsNumber(NumInvalid)));
+	Info.ExpireDuration = 5.0f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+	OpenManagerTab();
 }
 
 void FValidatorXModule::ShutdownModule()
 {
+	FValidatorXBackgroundScan::Get().Stop();
+	UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+	ValidatorX::UnregisterAssetTags();
+	FValidatorXSubgraphHashTable::Get().Save();
+	FValidatorXValidatorSchedule::Get().Save();
+	FValidatorXIssueFilter::Get().WriteBaseline();
+	FValidatorXReportWriter::Get().Close();
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(ValidatorXTabName);
 	UToolMenus::UnregisterOwner(this);
 }
@@ -58,6 +284,12 @@ void FValidatorXModule::HandlePostEngineInit()
 {
 	UE_LOG(LogTemp, Warning, TEXT("Startup Begin"));
 
+	FValidatorXSubgraphHashTable::Get().Load();
+	FValidatorXCompileProfiler::Get().Load();
+	FValidatorXValidatorSchedule::Get().Load();
+	FValidatorXIssueFilter::Get().Initialize();
+	FValidatorXReportWriter::Get().InitializeFromCommandLine();
+
 	if(GEditor)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("GEditor is valid"));
@@ -67,6 +299,8 @@ void FValidatorXModule::HandlePostEngineInit()
 		{
 			UE_LOG(LogTemp, Warning, TEXT("ValidatorSubsystem is valid"));
 
+			// Disabling every validator and applying the preset end in a single config write
+			const FValidatorXConfigManager::FBatchScope ConfigBatch;
 			ValidatorSubsystem->ForEachEnabledValidator(
 				[this] (UEditorValidatorBase* Validator)
 				{
@@ -80,11 +314,17 @@ void FValidatorXModule::HandlePostEngineInit()
 					}
 					return true;
 				});
+			FValidatorXConfigManager::Get().ApplyCommandLinePreset();
 		}
 		else
 		{
 			UE_LOG(LogTemp, Warning, TEXT("ValidatorSubsystem is nullptr"));
 		}
+
+		if(!IsRunningCommandlet() && FParse::Param(FCommandLine::Get(), TEXT("ValidatorXBackgroundScan")))
+		{
+			FValidatorXBackgroundScan::Get().Start();
+		}
 	}
 }
 
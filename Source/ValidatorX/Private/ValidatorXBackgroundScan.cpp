@@ -0,0 +1,322 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ValidatorXBackgroundScan.h"
+#include "Analysis/SubgraphHashTable.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DataValidation.h"
+#include "Misc/PackageName.h"
+#include "Reporting/IssueLog.h"
+#include "Reporting/ValidatorSchedule.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogValidatorXScan, Log, All);
+
+void FValidatorXBackgroundScan::Start()
+{
+	if(IsRunning())
+	{
+		return;
+	}
+
+	// The initial scan of a large project takes a while, queueing before it ends would miss most assets
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	if(AssetRegistry.IsLoadingAssets())
+	{
+		RegistryHandle = AssetRegistry.OnFilesLoaded().AddLambda([this]
+			{
+				IAssetRegistry::GetChecked().OnFilesLoaded().Remove(RegistryHandle);
+				RegistryHandle.Reset();
+				Start();
+			});
+		return;
+	}
+
+	double BudgetMs = BudgetSeconds * 1000.0;
+	FParse::Value(FCommandLine::Get(), TEXT("ValidatorXScanBudgetMs="), BudgetMs);
+	BudgetSeconds = FMath::Max(BudgetMs, 0.5) / 1000.0;
+
+	Validators.Reset();
+	for(TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if(Class->IsChildOf(UBlueprintValidatorBase::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			Validators.Emplace(NewObject<UBlueprintValidatorBase>(GetTransientPackage(), Class));
+		}
+	}
+	FValidatorXValidatorSchedule::Get().SortValidators(Validators);
+
+	ScanSerial++;
+	LoadedAssets.Reset();
+	NextIndex = 0;
+	NextRequest = 0;
+	CurrentAsset.Reset();
+	BuildQueue();
+
+	StartTime = FPlatformTime::Seconds();
+	LastProgressTime = StartTime;
+	ScanSeconds = 0.0;
+	bPaused = false;
+	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FValidatorXBackgroundScan::Tick));
+
+	UE_LOG(LogValidatorXScan, Display, TEXT("Background scan of %d Blueprints started, %.1f ms per frame"), Queue.Num(), BudgetSeconds * 1000.0);
+}
+
+void FValidatorXBackgroundScan::Stop()
+{
+	if(RegistryHandle.IsValid())
+	{
+		if(IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+		{
+			AssetRegistry->OnFilesLoaded().Remove(RegistryHandle);
+		}
+		RegistryHandle.Reset();
+	}
+
+	if(!TickHandle.IsValid())
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+
+	// Loads still in flight complete into nothing, what was validated so far stays
+	ScanSerial++;
+	FValidatorXSubgraphHashTable::Get().Save();
+	FValidatorXValidatorSchedule::Get().Save();
+	LoadedAssets.Reset();
+	CurrentAsset.Reset();
+	Validators.Reset();
+	Queue.Reset();
+	NextIndex = 0;
+	NextRequest = 0;
+	ProgressEvent.Broadcast();
+}
+
+FText FValidatorXBackgroundScan::GetStatusText() const
+{
+	if(RegistryHandle.IsValid())
+	{
+		return INVTEXT("Background scan waiting for the asset registry");
+	}
+	if(TickHandle.IsValid())
+	{
+		return FText::Format(bPaused ? INVTEXT("Background scan: {0} of {1} Blueprints (paused)") : INVTEXT("Background scan: {0} of {1} Blueprints"),
+			FText::AsNumber(NextIndex), FText::AsNumber(Queue.Num()));
+	}
+	if(Queue.Num() > 0)
+	{
+		return FText::Format(INVTEXT("Background scan finished: {0} Blueprints in {1} s"),
+			FText::AsNumber(Queue.Num()), FText::AsNumber(FMath::RoundToInt(ScanSeconds)));
+	}
+	return FText::GetEmpty();
+}
+
+void FValidatorXBackgroundScan::BuildQueue()
+{
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(TEXT("/Game"));
+	Filter.bRecursivePaths = true;
+
+	Queue.Reset();
+	IAssetRegistry::GetChecked().GetAssets(Filter, Queue);
+
+	// Results of this session are already there, and nothing to load for assets no validator can have findings on
+	const FValidatorXIssueLog& IssueLog = FValidatorXIssueLog::Get();
+	Queue.RemoveAll([this, &IssueLog] (const FAssetData& AssetData)
+		{
+			return IssueLog.WasValidated(AssetData.PackageName) || !Validators.ContainsByPredicate([&AssetData] (const TStrongObjectPtr<UBlueprintValidatorBase>& Validator)
+				{
+					return Validator->CanValidateAssetData(AssetData);
+				});
+		});
+
+	// Open editors first, then the latest changes: those are the results someone is about to ask for
+	TSet<FName> OpenPackages;
+	if(GEditor)
+	{
+		for(const UObject* Asset : GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->GetAllEditedAssets())
+		{
+			if(Asset)
+			{
+				OpenPackages.Add(Asset->GetPackage()->GetFName());
+			}
+		}
+	}
+
+	TMap<FName, FDateTime> Timestamps;
+	Timestamps.Reserve(Queue.Num());
+	for(const FAssetData& AssetData : Queue)
+	{
+		FString Filename;
+		if(FPackageName::TryConvertLongPackageNameToFilename(AssetData.PackageName.ToString(), Filename, FPackageName::GetAssetPackageExtension()))
+		{
+			Timestamps.Add(AssetData.PackageName, IFileManager::Get().GetTimeStamp(*Filename));
+		}
+	}
+
+	Queue.Sort([&OpenPackages, &Timestamps] (const FAssetData& A, const FAssetData& B)
+		{
+			const bool bIsAOpen = OpenPackages.Contains(A.PackageName);
+			if(bIsAOpen != OpenPackages.Contains(B.PackageName))
+			{
+				return bIsAOpen;
+			}
+
+			const FDateTime TimestampA = Timestamps.FindRef(A.PackageName);
+			const FDateTime TimestampB = Timestamps.FindRef(B.PackageName);
+			if(TimestampA != TimestampB)
+			{
+				return TimestampA > TimestampB;
+			}
+			return A.PackageName.LexicalLess(B.PackageName);
+		});
+}
+
+bool FValidatorXBackgroundScan::Tick(float DeltaTime)
+{
+	bPaused = !IsEditorIdle();
+	if(bPaused)
+	{
+		return true;
+	}
+
+	RequestLoads();
+
+	const double TickStartTime = FPlatformTime::Seconds();
+	const int32 FirstIndex = NextIndex;
+	while(NextIndex < Queue.Num() && FPlatformTime::Seconds() - TickStartTime < BudgetSeconds)
+	{
+		if(!CurrentAsset.IsValid())
+		{
+			TStrongObjectPtr<UObject> LoadedAsset;
+			if(!LoadedAssets.RemoveAndCopyValue(NextIndex, LoadedAsset))
+			{
+				// Still loading; the editor tick moves it along, never wait for it here
+				break;
+			}
+
+			const FAssetData& AssetData = Queue[NextIndex];
+			UObject* Asset = LoadedAsset.Get();
+
+			// Saved or validated from the editor since it was queued
+			if(!Asset || FValidatorXIssueLog::Get().WasValidated(AssetData.PackageName) || Validators.IsEmpty())
+			{
+				if(!Asset)
+				{
+					UE_LOG(LogValidatorXScan, Warning, TEXT("Could not load '%s'"), *AssetData.GetObjectPathString());
+				}
+				NextIndex++;
+				RequestLoads();
+				continue;
+			}
+
+			CurrentAsset.Reset(Asset);
+			NextValidator = 0;
+		}
+
+		// The budget is checked between validators, not only between assets
+		ValidateStep();
+		if(!CurrentAsset.IsValid())
+		{
+			RequestLoads();
+		}
+	}
+	ScanSeconds += FPlatformTime::Seconds() - TickStartTime;
+
+	if(NextIndex >= Queue.Num())
+	{
+		Finish();
+		return false;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if(NextIndex > FirstIndex && Now - LastProgressTime >= 1.0)
+	{
+		LastProgressTime = Now;
+		ProgressEvent.Broadcast();
+	}
+	return true;
+}
+
+bool FValidatorXBackgroundScan::IsEditorIdle() const
+{
+	if(GIsSlowTask || (GEditor && GEditor->PlayWorld) || !FSlateApplication::IsInitialized())
+	{
+		return false;
+	}
+
+	const FSlateApplication& SlateApplication = FSlateApplication::Get();
+	return !SlateApplication.GetActiveModalWindow().IsValid()
+		&& SlateApplication.GetCurrentTime() - SlateApplication.GetLastUserInteractionTime() >= IdleDelay;
+}
+
+void FValidatorXBackgroundScan::RequestLoads()
+{
+	while(NextRequest < Queue.Num() && NextRequest - NextIndex < LoadAhead)
+	{
+		const int32 RequestIndex = NextRequest++;
+		const FAssetData& AssetData = Queue[RequestIndex];
+
+		// Open and recently used assets are already in memory, hold them so a collection does not drop them
+		if(AssetData.IsAssetLoaded())
+		{
+			LoadedAssets.Add(RequestIndex, TStrongObjectPtr<UObject>(AssetData.FastGetAsset(false)));
+			continue;
+		}
+
+		const uint32 Serial = ScanSerial;
+		LoadPackageAsync(AssetData.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+			[this, Serial, RequestIndex, AssetName = AssetData.AssetName] (const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+			{
+				if(Serial == ScanSerial)
+				{
+					// The asset rather than its package, a package does not keep its objects alive
+					UObject* Asset = Result == EAsyncLoadingResult::Succeeded && Package ? StaticFindObjectFast(UObject::StaticClass(), Package, AssetName) : nullptr;
+					LoadedAssets.Add(RequestIndex, TStrongObjectPtr<UObject>(Asset));
+				}
+			}));
+	}
+}
+
+void FValidatorXBackgroundScan::ValidateStep()
+{
+	// Nobody reads the context, the issue log and the dashboard are where the results show up
+	const FValidatorXIssueLog::FSuspendFormattingScope SuspendFormatting;
+	FDataValidationContext Context(false, EDataValidationUsecase::None, {});
+	Validators[NextValidator++]->RunValidation(Queue[NextIndex], CurrentAsset.Get(), Context);
+
+	// Released here, the engine collects the package on its own schedule once nothing else holds it
+	if(NextValidator >= Validators.Num())
+	{
+		CurrentAsset.Reset();
+		NextIndex++;
+	}
+}
+
+void FValidatorXBackgroundScan::Finish()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+	TickHandle.Reset();
+	LoadedAssets.Reset();
+	CurrentAsset.Reset();
+	Validators.Reset();
+
+	FValidatorXSubgraphHashTable::Get().Save();
+	FValidatorXValidatorSchedule::Get().Save();
+
+	UE_LOG(LogValidatorXScan, Display, TEXT("Background scan of %d Blueprints finished in %.1f s of frame time (%.0f s elapsed), %d issues recorded"),
+		Queue.Num(), ScanSeconds, FPlatformTime::Seconds() - StartTime, FValidatorXIssueLog::Get().Num());
+	ProgressEvent.Broadcast();
+}
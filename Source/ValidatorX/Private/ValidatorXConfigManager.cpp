@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ValidatorXConfigManager.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Reporting/ValidatorSchedule.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+#include "ValidatorXStateFiles.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogValidatorXConfig, Log, All);
+
+FValidatorXConfigManager::FValidatorXConfigManager()
+{
+	FValidatorXPreset& SaveTimeFast = Presets.AddDefaulted_GetRef();
+	SaveTimeFast.Name = TEXT("SaveTimeFast");
+	SaveTimeFast.DisplayName = INVTEXT("Save-time fast");
+	SaveTimeFast.Description = INVTEXT("Validators not declared expensive, with fail-fast on save");
+	SaveTimeFast.bFailFast = true;
+	SaveTimeFast.IncludesValidator = [] (const UBlueprintValidatorBase* Validator)
+		{
+			// The declared cost only; measured timings change between runs and the preset would drift to Custom
+			return !Validator->IsExpensive();
+		};
+
+	FValidatorXPreset& CIFull = Presets.AddDefaulted_GetRef();
+	CIFull.Name = TEXT("CIFull");
+	CIFull.DisplayName = INVTEXT("CI full");
+	CIFull.Description = INVTEXT("Every validator, nothing skipped");
+	CIFull.IncludesValidator = [] (const UBlueprintValidatorBase* Validator)
+		{
+			return true;
+		};
+
+	// Runtime, memory and build cost of the Blueprint rather than graph hygiene
+	FValidatorXPreset& PerfAudit = Presets.AddDefaulted_GetRef();
+	PerfAudit.Name = TEXT("PerfAudit");
+	PerfAudit.DisplayName = INVTEXT("Perf audit");
+	PerfAudit.Description = INVTEXT("Tick, animation, replication, widget binding, loop, hard reference, cast and compile cost validators");
+	PerfAudit.IncludesValidator = [] (const UBlueprintValidatorBase* Validator)
+		{
+			static const FName PerfValidators[] =
+			{
+				TEXT("TickEfficiencyValidator"),
+				TEXT("AnimBlueprintCostValidator"),
+				TEXT("ReplicationCostValidator"),
+				TEXT("WidgetBindingValidator"),
+				TEXT("LoopNestingValidator"),
+				TEXT("HardReferenceSizeValidator"),
+				TEXT("CastDependencyValidator"),
+				TEXT("CompileTimeValidator"),
+			};
+			return MakeArrayView(PerfValidators).Contains(Validator->GetClass()->GetFName());
+		};
+}
+
+void FValidatorXConfigManager::WriteEnabled(const UClass* Validator, bool bEnabled)
+{
+	bActivePresetDirty = true;
+	if(!Validator || !GConfig)
+	{
+		return;
+	}
+
+	// Same section and key UObject::SaveConfig writes, without rewriting the validator's other settings
+	const FString ConfigFile = Validator->GetConfigName();
+	GConfig->SetBool(*Validator->GetPathName(), TEXT("bIsEnabled"), bEnabled, ConfigFile);
+	DirtyConfigFiles.Add(ConfigFile);
+
+	if(NumBatches == 0)
+	{
+		Flush();
+	}
+}
+
+void FValidatorXConfigManager::Flush()
+{
+	// Shards of one commandlet run share the config files, the cache is enough for them
+	if(ValidatorX::IsPersistingState())
+	{
+		for(const FString& ConfigFile : DirtyConfigFiles)
+		{
+			GConfig->Flush(false, ConfigFile);
+		}
+	}
+	DirtyConfigFiles.Reset();
+}
+
+const TArray<UBlueprintValidatorBase*>& FValidatorXConfigManager::GetValidatorDefaults() const
+{
+	if(ValidatorDefaults.IsEmpty())
+	{
+		for(TObjectIterator<UClass> It; It; ++It)
+		{
+			UClass* Class = *It;
+			if(Class->IsChildOf(UBlueprintValidatorBase::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+			{
+				ValidatorDefaults.Add(Class->GetDefaultObject<UBlueprintValidatorBase>());
+			}
+		}
+	}
+	return ValidatorDefaults;
+}
+
+void FValidatorXConfigManager::SetAllEnabled(bool bEnabled)
+{
+	const FBatchScope Batch;
+	for(UBlueprintValidatorBase* Validator : GetValidatorDefaults())
+	{
+		if(!Validator->IsConfigDisabled())
+		{
+			Validator->SetValidationEnabled(bEnabled);
+		}
+	}
+}
+
+const FValidatorXPreset* FValidatorXConfigManager::FindPreset(FName Name) const
+{
+	return Presets.FindByPredicate([Name] (const FValidatorXPreset& Preset) { return Preset.Name == Name; });
+}
+
+bool FValidatorXConfigManager::ApplyPreset(FName Name)
+{
+	const FValidatorXPreset* Preset = FindPreset(Name);
+	if(!Preset)
+	{
+		UE_LOG(LogValidatorXConfig, Warning, TEXT("Unknown ValidatorX preset '%s'"), *Name.ToString());
+		return false;
+	}
+
+	{
+		const FBatchScope Batch;
+		for(UBlueprintValidatorBase* Validator : GetValidatorDefaults())
+		{
+			if(!Validator->IsConfigDisabled())
+			{
+				Validator->SetValidationEnabled(Preset->IncludesValidator(Validator));
+			}
+		}
+	}
+	FValidatorXValidatorSchedule::Get().SetFailFastEnabled(Preset->bFailFast);
+
+	UE_LOG(LogValidatorXConfig, Display, TEXT("Applied ValidatorX preset '%s'"), *Preset->DisplayName.ToString());
+	return true;
+}
+
+const FValidatorXPreset* FValidatorXConfigManager::GetActivePreset() const
+{
+	// Every toggle goes through WriteEnabled, the fail-fast checkbox of the schedule panel does not
+	const bool bFailFast = FValidatorXValidatorSchedule::Get().IsFailFastEnabled();
+	if(!bActivePresetDirty && bFailFast == bCachedFailFast)
+	{
+		return ActivePreset;
+	}
+
+	const TArray<UBlueprintValidatorBase*>& Defaults = GetValidatorDefaults();
+	ActivePreset = Presets.FindByPredicate([&Defaults, bFailFast] (const FValidatorXPreset& Preset)
+		{
+			return Preset.bFailFast == bFailFast && !Defaults.ContainsByPredicate([&Preset] (const UBlueprintValidatorBase* Validator)
+				{
+					return !Validator->IsConfigDisabled() && Validator->IsEnabled() != Preset.IncludesValidator(Validator);
+				});
+		});
+	bCachedFailFast = bFailFast;
+	bActivePresetDirty = false;
+	return ActivePreset;
+}
+
+void FValidatorXConfigManager::ApplyCommandLinePreset()
+{
+	FString PresetName;
+	if(FParse::Value(FCommandLine::Get(), TEXT("ValidatorXPreset="), PresetName))
+	{
+		ApplyPreset(FName(*PresetName));
+	}
+}
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ValidatorXStateFiles.h"
+#include "HAL/FileManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+
+namespace ValidatorX
+{
+	namespace
+	{
+		/** Unique per process, two processes saving the same file never share a temporary */
+		FString GetTemporaryPath(const FString& FilePath)
+		{
+			return FString::Printf(TEXT("%s.%u.tmp"), *FilePath, FPlatformProcess::GetCurrentProcessId());
+		}
+
+		bool MoveIntoPlace(const FString& TemporaryPath, const FString& FilePath)
+		{
+			if(IFileManager::Get().Move(*FilePath, *TemporaryPath, true, true))
+			{
+				return true;
+			}
+			IFileManager::Get().Delete(*TemporaryPath, false, false, true);
+			return false;
+		}
+	}
+
+	bool IsPersistingState()
+	{
+		static const bool bPersist = !FParse::Param(FCommandLine::Get(), TEXT("ValidatorXNoPersist"));
+		return bPersist;
+	}
+
+	bool SaveStringAtomically(const FString& Text, const FString& FilePath)
+	{
+		const FString TemporaryPath = GetTemporaryPath(FilePath);
+		return FFileHelper::SaveStringToFile(Text, *TemporaryPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& MoveIntoPlace(TemporaryPath, FilePath);
+	}
+
+	bool SaveArchiveAtomically(const FString& FilePath, TFunctionRef<void(FArchive&)> Write)
+	{
+		const FString TemporaryPath = GetTemporaryPath(FilePath);
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TemporaryPath));
+		if(!Writer)
+		{
+			return false;
+		}
+
+		Write(*Writer);
+		const bool bWritten = Writer->Close();
+		Writer.Reset();
+
+		if(!bWritten)
+		{
+			IFileManager::Get().Delete(*TemporaryPath, false, false, true);
+			return false;
+		}
+		return MoveIntoPlace(TemporaryPath, FilePath);
+	}
+}
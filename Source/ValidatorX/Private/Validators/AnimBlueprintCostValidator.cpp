@@ -0,0 +1,227 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/AnimBlueprintCostValidator.h"
+#include "Analysis/BlueprintCostModel.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Animation/AnimBlueprint.h"
+#include "AnimGraphNode_Base.h"
+#include "AnimationGraphSchema.h"
+#include "K2Node_BreakStruct.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_Knot.h"
+#include "K2Node_StructMemberGet.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	constexpr int32 MaxFastPathSearchDepth = 8;
+
+	bool IsFastPathSource(const UEdGraphNode* Node, int32 Depth = 0);
+
+	bool AreInputsFastPath(const UEdGraphNode* Node, int32 Depth)
+	{
+		for(const UEdGraphPin* Pin : Node->Pins)
+		{
+			if(!Pin || Pin->Direction != EGPD_Input) continue;
+
+			for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				if(LinkedPin && !IsFastPathSource(LinkedPin->GetOwningNode(), Depth + 1))
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	bool IsFastPathSource(const UEdGraphNode* Node, int32 Depth)
+	{
+		if(!Node || Depth > MaxFastPathSearchDepth)
+		{
+			return false;
+		}
+
+		if(const UK2Node_VariableGet* VarGet = Cast<UK2Node_VariableGet>(Node))
+		{
+			// Reading a member of another object goes through the VM
+			const UEdGraphPin* SelfPin = VarGet->FindPin(UEdGraphSchema_K2::PN_Self);
+			return !SelfPin || SelfPin->LinkedTo.Num() == 0;
+		}
+
+		if(Node->GetClass()->GetFName() == TEXT("K2Node_PropertyAccess"))
+		{
+			return true;
+		}
+
+		if(Node->IsA<UK2Node_Knot>() || Node->IsA<UK2Node_StructMemberGet>() || Node->IsA<UK2Node_BreakStruct>())
+		{
+			return AreInputsFastPath(Node, Depth);
+		}
+
+		if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			if(CallNode->FunctionReference.GetMemberName() == TEXT("Not_PreBool"))
+			{
+				return AreInputsFastPath(Node, Depth);
+			}
+		}
+
+		return false;
+	}
+
+	bool CanMoveToThreadSafeUpdate(const UEdGraphNode* Node)
+	{
+		if(Node->IsA<UK2Node_VariableGet>() || Node->IsA<UK2Node_VariableSet>() || Node->IsA<UK2Node_Knot>()
+			|| Node->IsA<UK2Node_BreakStruct>() || Node->IsA<UK2Node_StructMemberGet>())
+		{
+			return true;
+		}
+
+		if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+		{
+			return FBlueprintEditorUtils::HasFunctionBlueprintThreadSafeMetaData(CallNode->GetTargetFunction());
+		}
+
+		return false;
+	}
+}
+
+bool UAnimBlueprintCostValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UAnimBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UAnimBlueprintCostValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return InAssetData.IsInstanceOf(UAnimBlueprint::StaticClass());
+}
+
+EDataValidationResult UAnimBlueprintCostValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	constexpr int32 SlowPathPinCost = 3;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UAnimBlueprint* AnimBlueprint = Cast<UAnimBlueprint>(InAsset))
+	{
+		int32 SlowPathPinCount = 0;
+
+		TArray<UEdGraph*> AllGraphs;
+		AnimBlueprint->GetAllGraphs(AllGraphs);
+		for(UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				UAnimGraphNode_Base* AnimNode = Cast<UAnimGraphNode_Base>(Node);
+				if(!AnimNode) continue;
+
+				for(const UEdGraphPin* Pin : AnimNode->Pins)
+				{
+					if(!Pin || Pin->Direction != EGPD_Input || Pin->LinkedTo.Num() == 0 || UAnimationGraphSchema::IsPosePin(Pin->PinType))
+					{
+						continue;
+					}
+
+					const UEdGraphNode* SourceNode = Pin->LinkedTo[0]->GetOwningNode();
+					if(ValidatorX::IsFastPathSource(SourceNode))
+					{
+						continue;
+					}
+
+					SlowPathPinCount++;
+
+					ReportIssue(Context, MakeIssue(TEXT("SlowPathPin"), EMessageSeverity::Warning, AnimBlueprint, AnimNode, Pin->PinName));
+				}
+			}
+		}
+
+		int32 UpdateCost = 0;
+		int32 MovableCost = 0;
+		if(UK2Node_Event* UpdateEvent = ValidatorX::FindEventNode(AnimBlueprint, FName(TEXT("BlueprintUpdateAnimation"))))
+		{
+			TSet<UEdGraphNode*> UpdateNodes;
+			UEdGraphNode* Roots[] = { UpdateEvent };
+			ValidatorX::CollectExecReachableNodes(AnimBlueprint, Roots, UpdateNodes);
+
+			for(UEdGraphNode* Node : UpdateNodes)
+			{
+				const int32 NodeCost = ValidatorX::EstimateNodeCost(Node);
+				UpdateCost += NodeCost;
+
+				const bool bMovable = ValidatorX::CanMoveToThreadSafeUpdate(Node);
+				if(bMovable)
+				{
+					MovableCost += NodeCost;
+				}
+
+				if(NodeCost >= HeavyNodeCost)
+				{
+					ReportIssue(Context, MakeIssue(TEXT("HeavyUpdateNode"), EMessageSeverity::Warning, AnimBlueprint, Node)
+						.Add(NodeCost)
+						.Add(bMovable ? 1 : 0));
+				}
+			}
+		}
+
+		const int32 GameThreadCost = UpdateCost + SlowPathPinCount * SlowPathPinCost;
+		if(GameThreadCost > 0)
+		{
+			const bool bOverBudget = GameThreadCost > GameThreadCostBudget;
+			ReportIssue(Context, MakeIssue(TEXT("GameThreadCost"), bOverBudget ? EMessageSeverity::Warning : EMessageSeverity::Info, AnimBlueprint)
+				.Add(GameThreadCost)
+				.Add(GameThreadCostBudget)
+				.Add(UpdateCost)
+				.Add(MovableCost)
+				.Add(SlowPathPinCount));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UAnimBlueprintCostValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("SlowPathPin"))
+	{
+		const UEdGraphNode* AnimNode = Issue.FindNode();
+		const UEdGraphPin* Pin = AnimNode ? AnimNode->FindPin(Issue.MemberName, EGPD_Input) : nullptr;
+		const UEdGraphNode* SourceNode = Pin && Pin->LinkedTo.Num() > 0 ? Pin->LinkedTo[0]->GetOwningNode() : nullptr;
+
+		return FText::Format(
+			INVTEXT("Pin '{0}' of anim node '{1}' is bound to '{2}', which is not on the fast path and runs Blueprint logic on every update. Compute the value into a member variable in a thread-safe update function and bind that instead."),
+			Pin ? Pin->GetDisplayName() : Issue.GetMemberText(),
+			Issue.GetNodeTitle(),
+			SourceNode ? SourceNode->GetNodeTitle(ENodeTitleType::ListView) : FText::GetEmpty()
+		);
+	}
+
+	if(Issue.RuleId == TEXT("HeavyUpdateNode"))
+	{
+		return FText::Format(
+			INVTEXT("Heavy node '{0}' (estimated cost {1}) runs on the game thread in BlueprintUpdateAnimation of '{2}'. {3}"),
+			Issue.GetNodeTitle(),
+			Issue.GetArg(0),
+			Issue.GetAssetText(),
+			Issue.GetNumberArg(1) != 0
+				? INVTEXT("It is thread safe and can move to BlueprintThreadSafeUpdateAnimation.")
+				: INVTEXT("Cache its result on an event or at a lower frequency, and keep only the cached value in the update.")
+		);
+	}
+
+	return FText::Format(
+		INVTEXT("Estimated game-thread cost of '{0}' per update: {1} (budget {2}). BlueprintUpdateAnimation: {3}, of which {4} could move to BlueprintThreadSafeUpdateAnimation. Anim node pins off the fast path: {5}."),
+		Issue.GetAssetText(),
+		Issue.GetArg(0),
+		Issue.GetArg(1),
+		Issue.GetArg(2),
+		Issue.GetArg(3),
+		Issue.GetArg(4)
+	);
+}
@@ -0,0 +1,174 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/CastDependencyValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintHardReferences.h"
+#include "Analysis/DependencySizeCache.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	bool IsAuditedCastReference(const FValidatorXReferenceEdge& Edge)
+	{
+		switch(Edge.Kind)
+		{
+		case EValidatorXReferenceKind::Cast:
+		case EValidatorXReferenceKind::Variable:
+		case EValidatorXReferenceKind::PinType:
+		case EValidatorXReferenceKind::PinDefault:
+			break;
+		default:
+			return false;
+		}
+
+		const UClass* ReferencedClass = Cast<UClass>(Edge.ReferencedObject);
+		return ReferencedClass && ReferencedClass->ClassGeneratedBy;
+	}
+
+	FText GetCastReferenceSuggestion(EValidatorXReferenceKind Kind)
+	{
+		return Kind == EValidatorXReferenceKind::Variable || Kind == EValidatorXReferenceKind::PinDefault
+			? INVTEXT("Store it as a Soft Object/Class Reference and load it on demand.")
+			: INVTEXT("Call it through a Blueprint Interface instead of casting to or typing against the concrete class.");
+	}
+}
+
+bool UCastDependencyValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UCastDependencyValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
+}
+
+EDataValidationResult UCastDependencyValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		FValidatorXDependencyCache& DependencyCache = FValidatorXDependencyCache::Get();
+		const int64 ThresholdBytes = static_cast<int64>(HeavyClassThresholdMB * 1024.0f * 1024.0f);
+
+		TArray<FValidatorXReferenceEdge> Edges;
+		ValidatorX::CollectHardReferenceEdges(Blueprint, Edges);
+
+		struct FHeavyClass
+		{
+			FName PackageName;
+			const UObject* ReferencedClass = nullptr;
+			FValidatorXDependencyCache::FClosureInfo Closure;
+			TArray<int32> EdgeIndices;
+		};
+
+		TMap<FName, FHeavyClass> HeavyClasses;
+		for(int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); ++EdgeIndex)
+		{
+			const FValidatorXReferenceEdge& Edge = Edges[EdgeIndex];
+			if(!ValidatorX::IsAuditedCastReference(Edge))
+			{
+				continue;
+			}
+
+			if(FHeavyClass* Existing = HeavyClasses.Find(Edge.PackageName))
+			{
+				Existing->EdgeIndices.Add(EdgeIndex);
+				continue;
+			}
+
+			const FValidatorXDependencyCache::FClosureInfo Closure = DependencyCache.GetClosure(Edge.PackageName);
+			if(Closure.TotalBytes < ThresholdBytes && Closure.PackageCount < HeavyClassDependencyCount)
+			{
+				continue;
+			}
+
+			FHeavyClass& HeavyClass = HeavyClasses.Add(Edge.PackageName);
+			HeavyClass.PackageName = Edge.PackageName;
+			HeavyClass.ReferencedClass = Edge.ReferencedObject;
+			HeavyClass.Closure = Closure;
+			HeavyClass.EdgeIndices.Add(EdgeIndex);
+		}
+
+		if(HeavyClasses.Num() == 0)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		// Memory first, load time (closure package count) second
+		TArray<FHeavyClass> Ranked;
+		HeavyClasses.GenerateValueArray(Ranked);
+		Ranked.Sort([] (const FHeavyClass& A, const FHeavyClass& B)
+			{
+				if(A.Closure.TotalBytes != B.Closure.TotalBytes)
+				{
+					return A.Closure.TotalBytes > B.Closure.TotalBytes;
+				}
+				return A.Closure.PackageCount > B.Closure.PackageCount;
+			});
+
+		for(int32 Rank = 0; Rank < Ranked.Num(); ++Rank)
+		{
+			const FHeavyClass& HeavyClass = Ranked[Rank];
+			const FValidatorXReferenceEdge& FirstEdge = Edges[HeavyClass.EdgeIndices[0]];
+
+			// Keyed by the referenced class so the fingerprint survives edits to the referencing nodes
+			ReportIssue(Context, MakeIssue(TEXT("HeavyCastDependency"), EMessageSeverity::Warning, Blueprint, FName(*HeavyClass.ReferencedClass->GetPathName()))
+				.Add(Rank + 1)
+				.Add(HeavyClass.ReferencedClass->GetFName())
+				.Add(HeavyClass.EdgeIndices.Num())
+				.Add(static_cast<int32>(FirstEdge.Kind))
+				.Add(FString(FirstEdge.SourceName))
+				.Add(FValidatorXIssueArg::Bytes(HeavyClass.Closure.TotalBytes))
+				.Add(HeavyClass.Closure.PackageCount)
+				.Add(DependencyCache.GetDirectDependencyCount(HeavyClass.PackageName))
+				.Add(FirstEdge.Node ? FirstEdge.Node->NodeGuid : FGuid()));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UCastDependencyValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	const EValidatorXReferenceKind Kind = static_cast<EValidatorXReferenceKind>(Issue.GetNumberArg(3));
+	return FText::Format(
+		INVTEXT("#{0}: Blueprint '{1}' hard-references '{2}' from {3} place(s) (first: {4} '{5}'). It weighs {6} on disk and loads {7} packages ({8} direct dependencies). {9}"),
+		{
+			Issue.GetArg(0),
+			Issue.GetAssetText(),
+			Issue.GetArg(1),
+			Issue.GetArg(2),
+			FText::FromString(ValidatorX::LexReferenceKind(Kind)),
+			Issue.GetArg(4),
+			Issue.GetArg(5),
+			Issue.GetArg(6),
+			Issue.GetArg(7),
+			ValidatorX::GetCastReferenceSuggestion(Kind)
+		}
+	);
+}
+
+void UCastDependencyValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	// The record is keyed by the referenced class; jump to the first referencing node or variable instead
+	FValidatorXIssue Reference = Issue;
+	Reference.MemberName = NAME_None;
+	Reference.NodeGuid = Issue.GetGuidArg(8);
+	if(!Reference.NodeGuid.IsValid())
+	{
+		if(static_cast<EValidatorXReferenceKind>(Issue.GetNumberArg(3)) == EValidatorXReferenceKind::Variable)
+		{
+			Reference.MemberName = FName(*Issue.Args[4].ToString());
+		}
+	}
+
+	Message.AddToken(FActionToken::Create(FText::FromString("Jump to reference"), FText::GetEmpty(),
+		FSimpleDelegate::CreateLambda([Reference]
+			{
+				ValidatorX::JumpToIssue(Reference);
+			})
+	));
+}
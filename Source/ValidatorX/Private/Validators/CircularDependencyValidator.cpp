@@ -6,12 +6,9 @@
 #include "K2Node_CallFunction.h"
 #include "K2Node_MacroInstance.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "Editor/EditorEngine.h"
-#include "Subsystems/AssetEditorSubsystem.h"
 #include "IAssetTools.h"
 #include "EdGraphSchema_K2.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditor.h"
 
 UEdGraph* UCircularDependencyValidator::FindGraphByName(UBlueprint* Blueprint, const FName& GraphName)
 {
@@ -33,46 +30,18 @@ UEdGraph* UCircularDependencyValidator::FindGraphByName(UBlueprint* Blueprint, c
 	return nullptr;
 }
 
-UCircularDependencyValidator::UCircularDependencyValidator()
-{
-	SetValidationEnabled(true);
-}
-
-void UCircularDependencyValidator::SetValidationEnabled(bool bEnabled)
-{
-	static UCircularDependencyValidator* CDO = GetMutableDefault<UCircularDependencyValidator>();
-	if(bIsConfigDisabled)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Validator is disabled by config!"));
-		return;
-	}
-
-	CDO->bIsEnabled = bEnabled;
-	SaveConfig();
-}
-
-bool UCircularDependencyValidator::IsEnabled() const
-{
-	static const UCircularDependencyValidator* CDO = GetDefault<UCircularDependencyValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
-
-}
-
 bool UCircularDependencyValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
 EDataValidationResult UCircularDependencyValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
-		if(HasCircularDependency(Blueprint, Context))
-		{
-			bIsError = true;
-		}
+		HasCircularDependency(Blueprint, Context);
 	}
 
 	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
@@ -117,31 +86,9 @@ bool UCircularDependencyValidator::HasCircularDependency(UBlueprint* Blueprint,
 
 		if(DetectCycle(Start, CallGraph, Visited, Stack, CyclePath))
 		{
-			FString CycleStr = FString::JoinBy(CyclePath, TEXT(" - "), [] (const FName& Name) { return Name.ToString(); });
-			const FText MessageText = FText::FromString(FString::Printf(TEXT("Circular call detected: %s"), *CycleStr));
-
-			TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Error, MessageText);
-			if(UEdGraph* TargetGraph = FindGraphByName(Blueprint, CyclePath[0]))
-			{
-				Message->AddToken(FActionToken::Create(
-					FText::FromString("Jump to graph"),
-					FText::FromString("Opens the first function or macro involved in the circular call"),
-					FSimpleDelegate::CreateLambda([Blueprint, TargetGraph] ()
-						{
-							if(UAssetEditorSubsystem* Subsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-							{
-								Subsystem->OpenEditorForAsset(Blueprint);
-								if(IAssetEditorInstance* EditorInstance = Subsystem->FindEditorForAsset(Blueprint, false))
-								{
-									if(IBlueprintEditor* BPEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
-									{
-										BPEditor->OpenGraphAndBringToFront(TargetGraph, true);
-									}
-								}
-							}
-						})
-				));
-			}
+			FValidatorXIssue Issue = MakeIssue(TEXT("CircularCall"), EMessageSeverity::Error, Blueprint, NAME_None, FindGraphByName(Blueprint, CyclePath[0]));
+			Issue.Add(FString::JoinBy(CyclePath, TEXT(" - "), [] (const FName& Name) { return Name.ToString(); }));
+			if(!ReportIssue(Context, Issue)) continue;
 
 			return true;
 		}
@@ -182,4 +129,7 @@ bool UCircularDependencyValidator::DetectCycle(const FName& StartName, TMap<FNam
 	return false;
 }
 
-
+FText UCircularDependencyValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(INVTEXT("Circular call detected: {0}"), Issue.GetArg(0));
+}
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/CompileTimeValidator.h"
+#include "Analysis/BlueprintMetrics.h"
+#include "Analysis/CompileProfiler.h"
+#include "Misc/DataValidation.h"
+
+bool UCompileTimeValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+EDataValidationResult UCompileTimeValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		FValidatorXCompileProfiler& Profiler = FValidatorXCompileProfiler::Get();
+		const FName PackageName = Blueprint->GetOutermost()->GetFName();
+
+		const FValidatorXCompileSample* Sample = Profiler.FindLatest(PackageName);
+		if(!Sample && bCompileWhenUnmeasured)
+		{
+			Profiler.ProfileBlueprint(Blueprint);
+			Profiler.Flush();
+			Sample = Profiler.FindLatest(PackageName);
+		}
+
+		if(!Sample || Sample->CompileMs <= CompileBudgetMs)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		const FValidatorXCompileSample* Previous = Profiler.FindPrevious(PackageName);
+		const FValidatorXBlueprintMetrics Current = ValidatorX::GatherBlueprintMetrics(Blueprint);
+
+		const bool bReported = ReportIssue(Context, MakeIssue(TEXT("CompileBudget"), EMessageSeverity::Warning, Blueprint)
+			.Add(FMath::RoundToInt(Sample->CompileMs))
+			.Add(FMath::RoundToInt(CompileBudgetMs))
+			.Add(Previous ? FMath::RoundToInt(Previous->CompileMs) : INDEX_NONE)
+			.Add(Current.NumGraphs)
+			.Add(Current.NumNodes)
+			.Add(Current.MaxGraphNodes)
+			.Add(Current.NumMacroInstances));
+
+		if(!bReported)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		if(Current.NumNodes != Sample->Metrics.NumNodes)
+		{
+			ReportIssue(Context, MakeIssue(TEXT("CompileSampleOutdated"), EMessageSeverity::Info, Blueprint));
+		}
+
+		// Graph shares only exist for measurements taken in this session
+		const int32 NumGraphsToList = FMath::Min(3, Sample->EstimatedGraphMs.Num());
+		for(int32 GraphIndex = 0; GraphIndex < NumGraphsToList; ++GraphIndex)
+		{
+			ReportIssue(Context, MakeIssue(TEXT("CompileGraphEstimate"), EMessageSeverity::Info, Blueprint, Sample->EstimatedGraphMs[GraphIndex].Key)
+				.Add(FMath::RoundToInt(Sample->EstimatedGraphMs[GraphIndex].Value)));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UCompileTimeValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("CompileSampleOutdated"))
+	{
+		return INVTEXT("The Blueprint changed since it was measured; profile it again to refresh the compile time.");
+	}
+
+	if(Issue.RuleId == TEXT("CompileGraphEstimate"))
+	{
+		return FText::Format(INVTEXT("  Graph '{0}': ~{1} ms (estimated from its share of the nodes)"), Issue.GetMemberText(), Issue.GetArg(0));
+	}
+
+	const int64 PreviousMs = Issue.GetNumberArg(2);
+	return FText::Format(
+		INVTEXT("Blueprint '{0}' took {1} ms to compile, over the budget of {2} ms{3}. It has {4} graphs, {5} nodes (largest graph {6}) and {7} macro instances; large graphs and macro instances dominate compile time, split them into functions."),
+		{
+			Issue.GetAssetText(),
+			Issue.GetArg(0),
+			Issue.GetArg(1),
+			PreviousMs != INDEX_NONE
+				? FText::Format(INVTEXT(" (previous measurement {0} ms)"), FText::AsNumber(PreviousMs))
+				: FText::GetEmpty(),
+			Issue.GetArg(3),
+			Issue.GetArg(4),
+			Issue.GetArg(5),
+			Issue.GetArg(6)
+		}
+	);
+}
@@ -2,29 +2,23 @@
 
 
 #include "Validators/DefaultAssignmentValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_VariableSet.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditor.h"
-
-UDefaultAssignmentValidator::UDefaultAssignmentValidator()
-{
-    SetValidationEnabled(true);
-}
 
 bool UDefaultAssignmentValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UDefaultAssignmentValidator::IsEnabled() const
+bool UDefaultAssignmentValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    static const UDefaultAssignmentValidator* CDO = GetDefault<UDefaultAssignmentValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
 }
 
 EDataValidationResult UDefaultAssignmentValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -61,41 +55,7 @@ EDataValidationResult UDefaultAssignmentValidator::ValidateLoadedAsset_Implement
 
                             if(PinDefaultValue == PropertyDefaultValue)
                             {
-                                const FText MessageText = FText::Format(
-                                    INVTEXT("Redundant assignment detected: variable '{0}' in Blueprint '{1}' is assigned its default value."),
-                                    FText::FromString(Graph->GetName()),
-                                    FText::FromString(Blueprint->GetName())
-                                );
-
-                                TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-                                Message->AddToken(FActionToken::Create(FText::FromString("Jump to Node"), FText::GetEmpty(),
-                                    FSimpleDelegate::CreateLambda([=]
-                                        {
-                                            if(Blueprint && Graph)
-                                            {
-                                                if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-                                                {
-                                                    AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                                    if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                                    {
-                                                        if(IBlueprintEditor* BlueprintEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
-                                                        {
-                                                            if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-                                                            {
-                                                                GraphEditor->JumpToNode(VarSetNode, false);
-                                                            }
-                                                        }
-                                                    }
-                                                }
-                                            }
-                                        }))
-                                );
-                                
-                                
-                                bIsError = true;
-
-
-
+                                ReportIssue(Context, MakeIssue(TEXT("RedundantDefaultAssignment"), EMessageSeverity::Warning, Blueprint, VarSetNode).Add(VarName));
                             }
                         }
                     }
@@ -107,3 +67,11 @@ EDataValidationResult UDefaultAssignmentValidator::ValidateLoadedAsset_Implement
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
 
+FText UDefaultAssignmentValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("Redundant assignment detected: variable '{0}' in Blueprint '{1}' is assigned its default value."),
+        Issue.GetArg(0),
+        Issue.GetAssetText()
+    );
+}
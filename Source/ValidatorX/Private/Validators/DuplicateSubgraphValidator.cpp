@@ -0,0 +1,272 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/DuplicateSubgraphValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Analysis/SubgraphHasher.h"
+#include "Analysis/SubgraphHashTable.h"
+#include "EdGraphSchema_K2.h"
+#include "Algo/AllOf.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	/**
+	 * A cluster is subsumed when every node consuming it (exec predecessors of an exec node, consumers of a
+	 * pure expression) is itself the root of a duplicated cluster: the larger duplicate already covers it.
+	 */
+	bool IsSubsumedCluster(const UEdGraphNode* RootNode, const TSet<const UEdGraphNode*>& DuplicatedRoots)
+	{
+		const bool bIsExecNode = HasExecPins(RootNode);
+		bool bHasConsumer = false;
+
+		for(const UEdGraphPin* Pin : RootNode->Pins)
+		{
+			if(!Pin) continue;
+
+			const bool bIsExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			const bool bIsConsumerPin = bIsExecNode
+				? Pin->Direction == EGPD_Input && bIsExecPin
+				: Pin->Direction == EGPD_Output;
+			if(!bIsConsumerPin) continue;
+
+			for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				bHasConsumer = true;
+				if(!DuplicatedRoots.Contains(LinkedPin->GetOwningNode()))
+				{
+					return false;
+				}
+			}
+		}
+
+		return bHasConsumer;
+	}
+}
+
+bool UDuplicateSubgraphValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UDuplicateSubgraphValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
+}
+
+EDataValidationResult UDuplicateSubgraphValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		TArray<UEdGraph*> AllGraphs = Blueprint->UbergraphPages;
+		AllGraphs.Append(Blueprint->FunctionGraphs);
+		AllGraphs.Append(Blueprint->MacroGraphs);
+
+		TArray<FValidatorXSubgraphHasher::FCluster> Clusters;
+		FValidatorXSubgraphHasher Hasher(ClusterChainLength);
+		for(const UEdGraph* Graph : AllGraphs)
+		{
+			Hasher.CollectClusters(Graph, MinClusterNodes, Clusters);
+		}
+
+		// Buckets of identical clusters, and of structurally identical clusters with different literals
+		TMap<uint64, TArray<int32>> ExactBuckets;
+		TMap<uint64, TArray<int32>> StructureBuckets;
+		for(int32 Index = 0; Index < Clusters.Num(); ++Index)
+		{
+			ExactBuckets.FindOrAdd(Clusters[Index].Hash).Add(Index);
+			StructureBuckets.FindOrAdd(Clusters[Index].StructureHash).Add(Index);
+		}
+
+		TSet<const UEdGraphNode*> DuplicatedRoots;
+		for(const TPair<uint64, TArray<int32>>& Pair : ExactBuckets)
+		{
+			if(Pair.Value.Num() < 2) continue;
+
+			for(const int32 Index : Pair.Value)
+			{
+				DuplicatedRoots.Add(Clusters[Index].RootNode);
+			}
+		}
+
+		TSet<const UEdGraphNode*> NearDuplicatedRoots;
+		for(TPair<uint64, TArray<int32>>& Pair : StructureBuckets)
+		{
+			// Keep one representative per exact hash, exact duplicates are reported separately
+			TSet<uint64> ExactHashes;
+			Pair.Value.RemoveAll([&] (int32 Index)
+				{
+					bool bAlreadyInSet = false;
+					ExactHashes.Add(Clusters[Index].Hash, &bAlreadyInSet);
+					return bAlreadyInSet;
+				});
+
+			if(Pair.Value.Num() < 2) continue;
+
+			for(const int32 Index : Pair.Value)
+			{
+				NearDuplicatedRoots.Add(Clusters[Index].RootNode);
+			}
+		}
+
+		int32 ReportedGroups = 0;
+		auto ReportBucket = [&] (const TArray<int32>& Bucket, const TSet<const UEdGraphNode*>& Roots, bool bExact)
+			{
+				if(Bucket.Num() < 2 || ReportedGroups >= MaxReportedGroups)
+				{
+					return;
+				}
+
+				const bool bAllSubsumed = Algo::AllOf(Bucket, [&] (int32 Index)
+					{
+						return ValidatorX::IsSubsumedCluster(Clusters[Index].RootNode, Roots);
+					});
+				if(bAllSubsumed)
+				{
+					return;
+				}
+
+				const FValidatorXSubgraphHasher::FCluster& First = Clusters[Bucket[0]];
+				FValidatorXIssue Issue = MakeIssue(bExact ? TEXT("DuplicateSubgraph") : TEXT("NearDuplicateSubgraph"), bExact ? EMessageSeverity::Warning : EMessageSeverity::Info, Blueprint, First.RootNode);
+				Issue.Add(Bucket.Num()).Add(First.Size);
+				for(const int32 Index : Bucket)
+				{
+					Issue.Add(Clusters[Index].RootNode->NodeGuid);
+				}
+
+				if(ReportIssue(Context, Issue))
+				{
+					ReportedGroups++;
+				}
+			};
+
+		for(const TPair<uint64, TArray<int32>>& Pair : ExactBuckets)
+		{
+			ReportBucket(Pair.Value, DuplicatedRoots, true);
+		}
+		for(const TPair<uint64, TArray<int32>>& Pair : StructureBuckets)
+		{
+			ReportBucket(Pair.Value, NearDuplicatedRoots, false);
+		}
+
+		if(bProjectWideDuplicates)
+		{
+			FValidatorXSubgraphHashTable& HashTable = FValidatorXSubgraphHashTable::Get();
+			const FName PackageName = Blueprint->GetOutermost()->GetFName();
+
+			// Forget this Blueprint's previous clusters so only other Blueprints are matched and counted
+			HashTable.ReplacePackage(PackageName, {});
+
+			// One cluster per exact hash is enough to find matches in other Blueprints
+			TArray<int32> CrossPackageClusters;
+			TSet<const UEdGraphNode*> CrossPackageRoots;
+			for(const TPair<uint64, TArray<int32>>& Pair : ExactBuckets)
+			{
+				int32 PackageCount = 0;
+				if(HashTable.FindInOtherPackage(Pair.Key, PackageName, PackageCount))
+				{
+					CrossPackageClusters.Add(Pair.Value[0]);
+					for(const int32 Index : Pair.Value)
+					{
+						CrossPackageRoots.Add(Clusters[Index].RootNode);
+					}
+				}
+			}
+
+			for(const int32 Index : CrossPackageClusters)
+			{
+				if(ReportedGroups >= MaxReportedGroups) break;
+
+				const FValidatorXSubgraphHasher::FCluster& Cluster = Clusters[Index];
+				if(ValidatorX::IsSubsumedCluster(Cluster.RootNode, CrossPackageRoots)) continue;
+
+				int32 PackageCount = 0;
+				const FValidatorXSubgraphHashTable::FLocation* Other = HashTable.FindInOtherPackage(Cluster.Hash, PackageName, PackageCount);
+
+				const bool bReported = ReportIssue(Context, MakeIssue(TEXT("CrossPackageDuplicate"), EMessageSeverity::Warning, Blueprint, Cluster.RootNode)
+					.Add(Cluster.Size)
+					.Add(PackageCount)
+					.Add(Other->PackageName)
+					.Add(Other->GraphName));
+				if(bReported)
+				{
+					ReportedGroups++;
+				}
+			}
+
+			TArray<FValidatorXSubgraphHashTable::FClusterRecord> Records;
+			Records.Reserve(Clusters.Num());
+			for(const FValidatorXSubgraphHasher::FCluster& Cluster : Clusters)
+			{
+				FValidatorXSubgraphHashTable::FClusterRecord& Record = Records.AddDefaulted_GetRef();
+				Record.Hash = Cluster.Hash;
+				Record.GraphName = Cluster.RootNode->GetGraph()->GetFName();
+				Record.NodeGuid = Cluster.RootNode->NodeGuid;
+				Record.Size = Cluster.Size;
+			}
+			HashTable.ReplacePackage(PackageName, MoveTemp(Records));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UDuplicateSubgraphValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("CrossPackageDuplicate"))
+	{
+		return FText::Format(
+			INVTEXT("The {0}-node subgraph starting at '{1}' in graph '{2}' also exists in {3} other Blueprint(s), e.g. '{4}' graph '{5}'. Move it to a shared function library or base class."),
+			{
+				Issue.GetArg(0),
+				Issue.GetNodeTitle(),
+				Issue.GetGraphText(),
+				Issue.GetArg(1),
+				Issue.GetArg(2),
+				Issue.GetArg(3)
+			}
+		);
+	}
+
+	return FText::Format(
+		Issue.RuleId == TEXT("DuplicateSubgraph")
+			? INVTEXT("'{0}' contains {1} identical copies of a {2}-node subgraph starting at '{3}' in graph '{4}'. Collapse it into a function or macro.")
+			: INVTEXT("'{0}' contains {1} near-identical copies of a {2}-node subgraph starting at '{3}' in graph '{4}' that only differ in pin values. Collapse it into a function with parameters."),
+		Issue.GetAssetText(),
+		Issue.GetArg(0),
+		Issue.GetArg(1),
+		Issue.GetNodeTitle(),
+		Issue.GetGraphText()
+	);
+}
+
+void UDuplicateSubgraphValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	if(Issue.RuleId == TEXT("CrossPackageDuplicate"))
+	{
+		Super::AddIssueTokens(Issue, Message);
+		return;
+	}
+
+	// The node GUIDs of all copies follow the count and size
+	for(int32 ArgIndex = 2; ArgIndex < Issue.Args.Num(); ++ArgIndex)
+	{
+		FValidatorXIssue Copy = Issue;
+		Copy.Node = nullptr;
+		Copy.NodeGuid = Issue.GetGuidArg(ArgIndex);
+		if(!Copy.NodeGuid.IsValid()) continue;
+
+		const UEdGraphNode* RootNode = Copy.FindNode();
+		Message.AddToken(FActionToken::Create(
+			FText::Format(INVTEXT("Copy {0} ({1})"), FText::AsNumber(ArgIndex - 1), RootNode ? FText::FromString(RootNode->GetGraph()->GetName()) : Issue.GetGraphText()),
+			FText::GetEmpty(),
+			FSimpleDelegate::CreateLambda([Copy]
+				{
+					ValidatorX::JumpToIssue(Copy);
+				})
+		));
+	}
+}
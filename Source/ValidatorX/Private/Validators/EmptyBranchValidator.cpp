@@ -2,23 +2,23 @@
 
 
 #include "Validators/EmptyBranchValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_IfThenElse.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditorModule.h"
 
-UEmptyBranchValidator::UEmptyBranchValidator()
+bool UEmptyBranchValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-    SetValidationEnabled(true);
+    return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UEmptyBranchValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+bool UEmptyBranchValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    return InAsset && InAsset->IsA<UBlueprint>();
+    return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
 }
 
 EDataValidationResult UEmptyBranchValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -40,36 +40,7 @@ EDataValidationResult UEmptyBranchValidator::ValidateLoadedAsset_Implementation(
                     // Only if BOTH branches are not connected
                     if(bThenUnconnected && bElseUnconnected)
                     {
-                        const FText MessageText = FText::Format(
-                            INVTEXT("Branch node in graph '{0}' has both 'Then' and 'Else' execution pins unconnected."),
-                            FText::FromString(Graph->GetName())
-                        );
-
-                        TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-                        Message->AddToken(FActionToken::Create(FText::FromString("Jump to Branch"), FText::GetEmpty(),
-                            FSimpleDelegate::CreateLambda([=]
-                                {
-                                    if(Blueprint && Graph)
-                                    {
-                                        if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-                                        {
-                                            AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                            if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                            {
-                                                if(IBlueprintEditor* BlueprintEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
-                                                {
-                                                    if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-                                                    {
-                                                        GraphEditor->JumpToNode(Branch, false);
-                                                    }
-                                                }
-                                            }
-                                        }
-                                    }
-                                }))
-                        );
-
-                        bIsError = true;
+                        ReportIssue(Context, MakeIssue(TEXT("EmptyBranch"), EMessageSeverity::Warning, Blueprint, Branch));
                     }
                 }
             }
@@ -79,8 +50,10 @@ EDataValidationResult UEmptyBranchValidator::ValidateLoadedAsset_Implementation(
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
 
-bool UEmptyBranchValidator::IsEnabled() const
+FText UEmptyBranchValidator::FormatIssue(const FValidatorXIssue& Issue) const
 {
-    static const UEmptyBranchValidator* CDO = GetDefault<UEmptyBranchValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+    return FText::Format(
+        INVTEXT("Branch node in graph '{0}' has both 'Then' and 'Else' execution pins unconnected."),
+        Issue.GetGraphText()
+    );
 }
\ No newline at end of file
@@ -2,31 +2,25 @@
 
 
 #include "Validators/EmptyFunctionValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "BlueprintEditor.h"
 #include "Misc/DataValidation.h"
 
-UEmptyFunctionValidator::UEmptyFunctionValidator()
-{
-	SetValidationEnabled(true);
-}
-
 bool UEmptyFunctionValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UEmptyFunctionValidator::IsEnabled() const
+bool UEmptyFunctionValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	static const UEmptyFunctionValidator* CDO = GetDefault<UEmptyFunctionValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumFunctions) != 0;
 }
 
 EDataValidationResult UEmptyFunctionValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if (UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
@@ -51,84 +45,47 @@ EDataValidationResult UEmptyFunctionValidator::ValidateLoadedAsset_Implementatio
 
 			if (UsefulNodeCount == 0)
 			{
-				const FText MessageText = FText::Format(
-					INVTEXT("Function '{0}' in Blueprint '{1}' is empty."),
-					FText::FromString(FunctionGraph->GetName()),
-					FText::FromString(Blueprint->GetName()));
-
-				const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-
-				const FText JumpToFunctionText = FText::Format(
-					INVTEXT("Jump to Function - '{0}'"),
-					FText::FromString(FunctionGraph->GetName()));
-
-				Message->AddToken(FActionToken::Create(JumpToFunctionText, FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
-						{
-							if(Blueprint && FunctionGraph)
-							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-									if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-									{
-										if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-										{
-											BlueprintEditor->OpenGraphAndBringToFront(FunctionGraph, true);
-										}
-									}
-								}
-							}
-						})));
-
-				const FText DeleteFunctionText = FText::Format(
-					INVTEXT("'Fix' - Delete Function - '{0}'"),
-					FText::FromString(FunctionGraph->GetName()));
-
-				Message->AddToken(FActionToken::Create(DeleteFunctionText, FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
-						{
-							if(Blueprint && FunctionGraph)
-							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-									FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-										{
-											if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-											{
-												if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-												{
-													const FText ConfirmText = FText::Format(
-														INVTEXT("Are you sure you want to delete the Function '{0}' from Blueprint '{1}'?"),
-														FText::FromString(FunctionGraph->GetName()),
-														FText::FromString(Blueprint->GetName())
-													);
-
-													if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-													{
-														Blueprint->Modify();
-														FunctionGraph->Modify();
-
-														Blueprint->FunctionGraphs.Remove(FunctionGraph);
-														FunctionGraph->MarkAsGarbage();
-
-														FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-													}
-												}
-											}
-											return false;
-										}));
-								}
-							}
-						})));
-				
-				bIsError = true;
+				ReportIssue(Context, MakeIssue(TEXT("EmptyFunction"), EMessageSeverity::Warning, Blueprint, NAME_None, FunctionGraph));
 			}
 		}
 	}
 	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
 
+FText UEmptyFunctionValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(
+		INVTEXT("Function '{0}' in Blueprint '{1}' is empty."),
+		Issue.GetGraphText(),
+		Issue.GetAssetText());
+}
+
+void UEmptyFunctionValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+	const FText DeleteFunctionText = FText::Format(INVTEXT("'Fix' - Delete Function - '{0}'"), Issue.GetGraphText());
+	const FText ConfirmText = FText::Format(
+		INVTEXT("Are you sure you want to delete the Function '{0}' from Blueprint '{1}'?"),
+		Issue.GetGraphText(),
+		Issue.GetAssetText()
+	);
 
+	Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteFunctionText, ConfirmText, [GraphName = Issue.GraphName] (UBlueprint* Blueprint)
+		{
+			const TObjectPtr<UEdGraph>* Found = Blueprint->FunctionGraphs.FindByPredicate([GraphName] (const UEdGraph* Graph) { return Graph && Graph->GetFName() == GraphName; });
+			if(!Found)
+			{
+				return;
+			}
+
+			UEdGraph* FunctionGraph = *Found;
+			Blueprint->Modify();
+			FunctionGraph->Modify();
+
+			Blueprint->FunctionGraphs.Remove(FunctionGraph);
+			FunctionGraph->MarkAsGarbage();
+
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}));
+}
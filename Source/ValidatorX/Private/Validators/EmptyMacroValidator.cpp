@@ -2,32 +2,26 @@
 
 
 #include "Validators/EmptyMacroValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_Tunnel.h"
 #include "K2Node_MacroInstance.h"
 
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "BlueprintEditor.h"
 #include "Misc/DataValidation.h"
 
-UEmptyMacroValidator::UEmptyMacroValidator()
-{
-	SetValidationEnabled(true);
-}
-
 bool UEmptyMacroValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UEmptyMacroValidator::IsEnabled() const
+bool UEmptyMacroValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	static const UEmptyMacroValidator* CDO = GetDefault<UEmptyMacroValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumMacros) != 0;
 }
 
 EDataValidationResult UEmptyMacroValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
@@ -50,109 +44,72 @@ EDataValidationResult UEmptyMacroValidator::ValidateLoadedAsset_Implementation(c
 
 			if(UsefulNodeCount == 0)
 			{
-				const FText MessageText = FText::Format(
-					INVTEXT("Macro '{0}' in Blueprint '{1}' is empty."),
-					FText::FromString(MacroGraph->GetName()),
-					FText::FromString(Blueprint->GetName()));
+				ReportIssue(Context, MakeIssue(TEXT("EmptyMacro"), EMessageSeverity::Warning, Blueprint, NAME_None, MacroGraph));
+			}
+		}
+	}
 
-				const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
 
-				const FText JumpToMacroText = FText::Format(
-					INVTEXT("Jump to Macro - '{0}'"),
-					FText::FromString(MacroGraph->GetName()));
+FText UEmptyMacroValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(
+		INVTEXT("Macro '{0}' in Blueprint '{1}' is empty."),
+		Issue.GetGraphText(),
+		Issue.GetAssetText());
+}
 
-				Message->AddToken(FActionToken::Create(JumpToMacroText, FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
-						{
-							if(Blueprint && MacroGraph)
-							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-									if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-									{
-										if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-										{
-											BlueprintEditor->OpenGraphAndBringToFront(MacroGraph, true);
-										}
-									}
-								}
-							}
-						})));
+void UEmptyMacroValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
 
-				const FText DeleteMacroText = FText::Format(
-					INVTEXT("'Fix' - Delete Macro - '{0}'"),
-					FText::FromString(MacroGraph->GetName()));
+	const FText DeleteMacroText = FText::Format(INVTEXT("'Fix' - Delete Macro - '{0}'"), Issue.GetGraphText());
+	const FText ConfirmText = FText::Format(
+		INVTEXT("Are you sure you want to delete the Macro '{0}' from Blueprint '{1}'?"),
+		Issue.GetGraphText(),
+		Issue.GetAssetText()
+	);
 
-				Message->AddToken(FActionToken::Create(DeleteMacroText, FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
+	Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteMacroText, ConfirmText, [GraphName = Issue.GraphName] (UBlueprint* Blueprint)
+		{
+			const TObjectPtr<UEdGraph>* Found = Blueprint->MacroGraphs.FindByPredicate([GraphName] (const UEdGraph* Graph) { return Graph && Graph->GetFName() == GraphName; });
+			if(!Found)
+			{
+				return;
+			}
+
+			UEdGraph* MacroGraph = *Found;
+			Blueprint->Modify();
+			auto RemoveMacroInstances = [=] (TArray<TObjectPtr<UEdGraph>>& Graphs)
+				{
+					for(UEdGraph* Graph : Graphs)
+					{
+						if(!Graph) continue;
+
+						TArray<UK2Node_MacroInstance*> MacroInstanceNodes;
+						Graph->GetNodesOfClass<UK2Node_MacroInstance>(MacroInstanceNodes);
+
+						for(UK2Node_MacroInstance* MacroInstanceNode : MacroInstanceNodes)
 						{
-							if(Blueprint && MacroGraph)
+							if(MacroInstanceNode && MacroInstanceNode->GetMacroGraph() == MacroGraph)
 							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-									FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-										{
-											if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-											{
-												if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-												{
-													const FText ConfirmText = FText::Format(
-														INVTEXT("Are you sure you want to delete the Macro '{0}' from Blueprint '{1}'?"),
-														FText::FromString(MacroGraph->GetName()),
-														FText::FromString(Blueprint->GetName())
-													);
-
-													if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-													{
-														Blueprint->Modify();
-														auto RemoveMacroInstances = [=] (TArray<TObjectPtr<UEdGraph>>& Graphs)
-															{
-																for(UEdGraph* Graph : Graphs)
-																{
-																	if(!Graph) continue;
-
-																	TArray<UK2Node_MacroInstance*> MacroInstanceNodes;
-																	Graph->GetNodesOfClass<UK2Node_MacroInstance>(MacroInstanceNodes);
-
-																	for(UK2Node_MacroInstance* MacroInstanceNode : MacroInstanceNodes)
-																	{
-																		if(MacroInstanceNode && MacroInstanceNode->GetMacroGraph() == MacroGraph)
-																		{
-																			Graph->Modify();
-																			MacroInstanceNode->DestroyNode();
-																		}
-																	}
-																}
-															};
-
-														
-														RemoveMacroInstances(Blueprint->UbergraphPages);
-														RemoveMacroInstances(Blueprint->FunctionGraphs);
-														RemoveMacroInstances(Blueprint->DelegateSignatureGraphs);
-														RemoveMacroInstances(Blueprint->IntermediateGeneratedGraphs);
-
-														Blueprint->MacroGraphs.Remove(MacroGraph);
-														MacroGraph->Modify();
-														MacroGraph->MarkAsGarbage();
-
-														FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-													}
-												}
-											}
-											return false;
-										}));
-								}
+								Graph->Modify();
+								MacroInstanceNode->DestroyNode();
 							}
-						})));
+						}
+					}
+				};
 
-				bIsError = true;
-			}
-		}
-	}
+			RemoveMacroInstances(Blueprint->UbergraphPages);
+			RemoveMacroInstances(Blueprint->FunctionGraphs);
+			RemoveMacroInstances(Blueprint->DelegateSignatureGraphs);
+			RemoveMacroInstances(Blueprint->IntermediateGeneratedGraphs);
 
-	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
-}
+			Blueprint->MacroGraphs.Remove(MacroGraph);
+			MacroGraph->Modify();
+			MacroGraph->MarkAsGarbage();
 
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}));
+}
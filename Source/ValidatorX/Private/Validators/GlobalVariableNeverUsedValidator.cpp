@@ -2,32 +2,25 @@
 
 
 #include "Validators/GlobalVariableNeverUsedValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_VariableSet.h"
 #include "K2Node_VariableGet.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditor.h"
-#include "SMyBlueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 
-UGlobalVariableNeverUsedValidator::UGlobalVariableNeverUsedValidator()
-{
-	SetValidationEnabled(true);
-}
-
-bool UGlobalVariableNeverUsedValidator::IsEnabled() const
+bool UGlobalVariableNeverUsedValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	static const UGlobalVariableNeverUsedValidator* CDO = GetDefault<UGlobalVariableNeverUsedValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UGlobalVariableNeverUsedValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+bool UGlobalVariableNeverUsedValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumVariables) != 0;
 }
 
 EDataValidationResult UGlobalVariableNeverUsedValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -69,78 +62,37 @@ EDataValidationResult UGlobalVariableNeverUsedValidator::ValidateLoadedAsset_Imp
 
             if(!bUsed)
             {
-                const FText MessageText = FText::Format(
-                    INVTEXT("Variable '{0}' in Blueprint '{1}' is never used."),
-                    FText::FromName(VarDesc.VarName),
-                    FText::FromString(Blueprint->GetName())
-                );
-
-                const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-
-                // Jump to variable
-                Message->AddToken(FActionToken::Create(
-                    FText::Format(INVTEXT("Jump to Variable - '{0}'"), FText::FromName(VarDesc.VarName)),
-                    FText::GetEmpty(),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint)
-                            {
-                                UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-                                if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                {
-                                    if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                    {
-                                        if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-                                        {
-                                            MyBlueprintWidget->SelectItemByName(VarDesc.VarName, ESelectInfo::Direct, INDEX_NONE, false);
-                                        }
-                                    }
-                                }
-                            }
-                        })));
-
-                // Fix - delete variable
-                Message->AddToken(FActionToken::Create(
-                    FText::Format(INVTEXT("'Fix' - Delete Variable - '{0}'"), FText::FromName(VarDesc.VarName)),
-                    FText::GetEmpty(),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint)
-                            {
-                                UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-                                FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-                                    {
-                                        if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                        {
-                                            if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                            {
-                                                const FText ConfirmText = FText::Format(
-                                                    INVTEXT("Are you sure you want to delete variable '{0}' from Blueprint '{1}'?"),
-                                                    FText::FromName(VarDesc.VarName),
-                                                    FText::FromString(Blueprint->GetName())
-                                                );
-
-                                                if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-                                                {
-                                                    FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, VarDesc.VarName);
-                                                    FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-                                                }
-                                            }
-                                        }
-
-                                        return false;
-                                    }));
-                            }
-                        })));
-
-                bIsError = true;
+                ReportIssue(Context, MakeIssue(TEXT("UnusedVariable"), EMessageSeverity::Warning, Blueprint, VarDesc.VarName));
             }
         }
     }
 
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText UGlobalVariableNeverUsedValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("Variable '{0}' in Blueprint '{1}' is never used."),
+        Issue.GetMemberText(),
+        Issue.GetAssetText()
+    );
+}
+
+void UGlobalVariableNeverUsedValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+    Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+    const FText DeleteVariableText = FText::Format(INVTEXT("'Fix' - Delete Variable - '{0}'"), Issue.GetMemberText());
+    const FText ConfirmText = FText::Format(
+        INVTEXT("Are you sure you want to delete variable '{0}' from Blueprint '{1}'?"),
+        Issue.GetMemberText(),
+        Issue.GetAssetText()
+    );
+
+    Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteVariableText, ConfirmText, [VarName = Issue.MemberName] (UBlueprint* Blueprint)
+        {
+            FBlueprintEditorUtils::RemoveMemberVariable(Blueprint, VarName);
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        }));
+}
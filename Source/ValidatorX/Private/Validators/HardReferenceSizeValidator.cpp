@@ -0,0 +1,118 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/HardReferenceSizeValidator.h"
+#include "Analysis/BlueprintHardReferences.h"
+#include "Analysis/DependencySizeCache.h"
+#include "Misc/DataValidation.h"
+
+bool UHardReferenceSizeValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+EDataValidationResult UHardReferenceSizeValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		FValidatorXDependencyCache& DependencyCache = FValidatorXDependencyCache::Get();
+
+		const int64 BudgetBytes = static_cast<int64>(ClosureBudgetMB * 1024.0f * 1024.0f);
+		const FValidatorXDependencyCache::FClosureInfo Closure = DependencyCache.GetClosure(Blueprint->GetOutermost()->GetFName());
+		const bool bReported = Closure.TotalBytes > BudgetBytes && ReportIssue(Context, MakeIssue(TEXT("HardReferenceBudget"), EMessageSeverity::Warning, Blueprint)
+			.Add(Closure.PackageCount)
+			.Add(FValidatorXIssueArg::Bytes(Closure.TotalBytes))
+			.Add(FValidatorXIssueArg::Bytes(BudgetBytes)));
+		if(!bReported)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		TArray<FValidatorXReferenceEdge> Edges;
+		ValidatorX::CollectHardReferenceEdges(Blueprint, Edges);
+
+		// One entry per referenced package, so a package referenced from many nodes cannot take every slot
+		TMap<FName, TPair<int32, int32>> FirstEdgeAndCountByPackage;
+		for(int32 EdgeIndex = 0; EdgeIndex < Edges.Num(); ++EdgeIndex)
+		{
+			TPair<int32, int32>& FirstEdgeAndCount = FirstEdgeAndCountByPackage.FindOrAdd(Edges[EdgeIndex].PackageName, { EdgeIndex, 0 });
+			FirstEdgeAndCount.Value++;
+		}
+
+		TArray<TPair<int64, FName>> RankedPackages;
+		RankedPackages.Reserve(FirstEdgeAndCountByPackage.Num());
+		for(const TPair<FName, TPair<int32, int32>>& Pair : FirstEdgeAndCountByPackage)
+		{
+			RankedPackages.Emplace(DependencyCache.GetClosure(Pair.Key).TotalBytes, Pair.Key);
+		}
+		RankedPackages.Sort([] (const TPair<int64, FName>& A, const TPair<int64, FName>& B)
+			{
+				return A.Key != B.Key ? A.Key > B.Key : A.Value.LexicalLess(B.Value);
+			});
+
+		const int32 NumReported = FMath::Min(RankedPackages.Num(), MaxReportedReferences);
+		for(int32 RankIndex = 0; RankIndex < NumReported; ++RankIndex)
+		{
+			const TPair<int32, int32>& FirstEdgeAndCount = FirstEdgeAndCountByPackage.FindChecked(RankedPackages[RankIndex].Value);
+			const FValidatorXReferenceEdge& Edge = Edges[FirstEdgeAndCount.Key];
+			const FValidatorXDependencyCache::FClosureInfo EdgeClosure = DependencyCache.GetClosure(Edge.PackageName);
+
+			// References without a node or variable are keyed by the referenced package
+			const FName VariableName = Edge.Kind == EValidatorXReferenceKind::Variable ? FName(*Edge.SourceName) : NAME_None;
+			ReportIssue(Context, MakeIssue(TEXT("HardReference"), EMessageSeverity::Info, Blueprint, Edge.Node, Edge.Node || !VariableName.IsNone() ? VariableName : Edge.PackageName)
+				.Add(static_cast<int32>(Edge.Kind))
+				.Add(FString(Edge.SourceName))
+				.Add(Edge.PackageName)
+				.Add(FValidatorXIssueArg::Bytes(EdgeClosure.TotalBytes))
+				.Add(EdgeClosure.PackageCount)
+				.Add(FirstEdgeAndCount.Value));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UHardReferenceSizeValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("HardReference"))
+	{
+		return FText::Format(
+			INVTEXT("{0} '{1}' pulls in '{2}' ({3} across {4} packages), referenced {5} {5}|plural(one=time,other=times) by this Blueprint."),
+			FText::FromString(ValidatorX::LexReferenceKind(static_cast<EValidatorXReferenceKind>(Issue.GetNumberArg(0)))),
+			Issue.GetArg(1),
+			Issue.GetArg(2),
+			Issue.GetArg(3),
+			Issue.GetArg(4),
+			Issue.GetArg(5)
+		);
+	}
+
+	return FText::Format(
+		INVTEXT("Blueprint '{0}' hard-references {1} packages totalling {2} on disk, which exceeds the budget of {3}. Heaviest references are listed below."),
+		Issue.GetAssetText(),
+		Issue.GetArg(0),
+		Issue.GetArg(1),
+		Issue.GetArg(2)
+	);
+}
+
+void UHardReferenceSizeValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	if(Issue.RuleId != TEXT("HardReference"))
+	{
+		return;
+	}
+
+	const bool bIsVariable = static_cast<EValidatorXReferenceKind>(Issue.GetNumberArg(0)) == EValidatorXReferenceKind::Variable;
+	if(Issue.NodeGuid.IsValid() || bIsVariable)
+	{
+		Message.AddToken(FActionToken::Create(FText::FromString("Jump to reference"), FText::GetEmpty(),
+			FSimpleDelegate::CreateLambda([Issue]
+				{
+					ValidatorX::JumpToIssue(Issue);
+				})
+		));
+	}
+}
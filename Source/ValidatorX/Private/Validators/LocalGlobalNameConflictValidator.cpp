@@ -2,33 +2,25 @@
 
 
 #include "Validators/LocalGlobalNameConflictValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_FunctionEntry.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditor.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "SMyBlueprint.h"
-
-ULocalGlobalNameConflictValidator::ULocalGlobalNameConflictValidator()
-{
-	SetValidationEnabled(true);
-
-}
 
 bool ULocalGlobalNameConflictValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool ULocalGlobalNameConflictValidator::IsEnabled() const
+bool ULocalGlobalNameConflictValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	static const ULocalGlobalNameConflictValidator* CDO = GetDefault<ULocalGlobalNameConflictValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumVariables) != 0 && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumFunctions) != 0;
 }
 
 
 EDataValidationResult ULocalGlobalNameConflictValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
@@ -63,119 +55,7 @@ EDataValidationResult ULocalGlobalNameConflictValidator::ValidateLoadedAsset_Imp
 				{
 					if(LocalVar.VarName == GlobalVar.VarName)
 					{
-						const FText MessageText = FText::Format(
-							INVTEXT("Local variable '{0}' in function '{1}' has the same name as a global variable."),
-							FText::FromName(LocalVar.VarName),
-							FText::FromString(Graph->GetName()));
-
-						const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-
-						const FText JumpToVariableText = FText::Format(
-							INVTEXT("Jump to variable - '{0}'"),
-							FText::FromName(LocalVar.VarName));
-
-						Message->AddToken(FActionToken::Create(JumpToVariableText, FText::FromString(""), 
-							FSimpleDelegate::CreateLambda([=]
-							{
-								if(Blueprint && EntryNode)
-								{
-									UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-									if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-									{
-										if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-										{
-											if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-											{
-												if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-												{
-													if (MyBlueprintWidget->SelectionAsLocalVar())
-													{
-														MyBlueprintWidget->SelectItemByName(LocalVar.VarName,
-															ESelectInfo::Direct,
-															INDEX_NONE,
-															false);
-													}
-												}
-											}
-										}
-									}
-								}
-							})));
-
-						const FText DeleteVariableText = FText::Format(
-							INVTEXT("'Fix' - Rename Local Variable - '{0}'"),
-							FText::FromName(LocalVar.VarName));
-
-						Message->AddToken(FActionToken::Create(DeleteVariableText, FText::FromString(""), 
-							FSimpleDelegate::CreateLambda([=]
-							{
-								if(Blueprint && EntryNode)
-								{
-									UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-									FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-										{
-											if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-											{
-												if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-												{
-													if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-													{
-														if(BlueprintEditor->GetMyBlueprintWidget().IsValid())
-														{
-															int32 IndexToRename = INDEX_NONE;
-
-															for(int32 i = 0; i < EntryNode->LocalVariables.Num(); ++i)
-															{
-																if(EntryNode->LocalVariables[i].VarName == LocalVar.VarName)
-																{
-																	IndexToRename = i;
-																	break;
-																}
-															}
-
-															if(IndexToRename != INDEX_NONE)
-															{
-																const FText ConfirmText = FText::Format(
-																	INVTEXT("Are you sure you want to rename the local variable '{0}' in function '{1}' to '{2}'?"),
-																	FText::FromName(LocalVar.VarName),
-																	FText::FromString(Graph->GetName()),
-																	FText::FromName(FName(*FString("Local") + LocalVar.VarName.ToString())));
-																FName NewName = FName(*FString("Local") + LocalVar.VarName.ToString());
-																if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-																{
-																	EntryNode->Modify();
-																	EntryNode->LocalVariables[IndexToRename].VarName = NewName;
-																	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-
-																	if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-																	{
-																		if(MyBlueprintWidget->SelectionAsLocalVar())
-																		{
-																			MyBlueprintWidget->SelectItemByName(NewName,
-																				ESelectInfo::Direct,
-																				INDEX_NONE,
-																				false);
-																		}
-																	}
-																}
-															}
-
-															return false;
-														}
-													}
-												}
-											}
-
-											return true;
-										}));
-								}
-							})));
-
-						bIsError = true;
+						ReportIssue(Context, MakeIssue(TEXT("LocalShadowsGlobal"), EMessageSeverity::Warning, Blueprint, LocalVar.VarName, Graph));
 					}
 				}
 			}
@@ -184,3 +64,48 @@ EDataValidationResult ULocalGlobalNameConflictValidator::ValidateLoadedAsset_Imp
 
 	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText ULocalGlobalNameConflictValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(
+		INVTEXT("Local variable '{0}' in function '{1}' has the same name as a global variable."),
+		Issue.GetMemberText(),
+		Issue.GetGraphText());
+}
+
+void ULocalGlobalNameConflictValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+	const FName NewName = FName(*FString("Local") + Issue.MemberName.ToString());
+	const FText RenameVariableText = FText::Format(INVTEXT("'Fix' - Rename Local Variable - '{0}'"), Issue.GetMemberText());
+	const FText ConfirmText = FText::Format(
+		INVTEXT("Are you sure you want to rename the local variable '{0}' in function '{1}' to '{2}'?"),
+		Issue.GetMemberText(),
+		Issue.GetGraphText(),
+		FText::FromName(NewName));
+
+	Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, RenameVariableText, ConfirmText, [GraphName = Issue.GraphName, VarName = Issue.MemberName, NewName] (UBlueprint* Blueprint)
+		{
+			TArray<UEdGraph*> AllGraphs;
+			Blueprint->GetAllGraphs(AllGraphs);
+			for(UEdGraph* Graph : AllGraphs)
+			{
+				if(!Graph || Graph->GetFName() != GraphName) continue;
+
+				TArray<UK2Node_FunctionEntry*> EntryNodes;
+				Graph->GetNodesOfClass<UK2Node_FunctionEntry>(EntryNodes);
+				for(UK2Node_FunctionEntry* EntryNode : EntryNodes)
+				{
+					const int32 IndexToRename = EntryNode->LocalVariables.IndexOfByPredicate([VarName] (const FBPVariableDescription& LocalVar) { return LocalVar.VarName == VarName; });
+					if(IndexToRename != INDEX_NONE)
+					{
+						EntryNode->Modify();
+						EntryNode->LocalVariables[IndexToRename].VarName = NewName;
+						FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+						return;
+					}
+				}
+			}
+		}));
+}
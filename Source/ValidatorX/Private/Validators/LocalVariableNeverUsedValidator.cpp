@@ -2,43 +2,32 @@
 
 
 #include "Validators/LocalVariableNeverUsedValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_LocalVariable.h"
 #include "EdGraph/EdGraphNode.h"
 #include "EdGraphSchema_K2.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditorModule.h"
-#include "GraphEditor.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
-#include "Subsystems/AssetEditorSubsystem.h"
-#include "Editor.h"
-#include "BlueprintEditor.h"
-#include "SMyBlueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 
 
-ULocalVariableNeverUsedValidator::ULocalVariableNeverUsedValidator()
-{
-    SetValidationEnabled(true);
-}
-
 bool ULocalVariableNeverUsedValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) const
 {
-    return InAsset && InAsset->IsA<UBlueprint>();
+    return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(Context);
 }
 
-bool ULocalVariableNeverUsedValidator::IsEnabled() const
+bool ULocalVariableNeverUsedValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    static const ULocalVariableNeverUsedValidator* CDO = GetDefault<ULocalVariableNeverUsedValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+    return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumFunctions) != 0;
 }
 
 EDataValidationResult ULocalVariableNeverUsedValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
   
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -87,92 +76,7 @@ EDataValidationResult ULocalVariableNeverUsedValidator::ValidateLoadedAsset_Impl
      
                  if(!bUsed)
                  {
-                     const FText MessageText = FText::Format(
-                         INVTEXT("Local variable '{0}' in function '{1}' is never used."),
-                         FText::FromName(LocalVar.VarName),
-                         FText::FromString(Graph->GetName()));
-
-                     const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-                     const FText JumpToVariableText = FText::Format(INVTEXT("Jump to variable  - '{0}'"), FText::FromName(LocalVar.VarName));
-                     Message->AddToken(FActionToken::Create(JumpToVariableText, FText::FromString(""), FSimpleDelegate::CreateLambda([=]
-                         {
-                             if(Blueprint && EntryNode)
-                             {
-                                 UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                 AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                 if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                 {
-                                     if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                     {
-                                         if (TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-                                         {
-                                             if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-                                             {
-                                                 MyBlueprintWidget->SelectItemByName(LocalVar.VarName,
-                                                     ESelectInfo::Direct,
-                                                     INDEX_NONE,
-                                                     false);
-                                             }
-                                         }
-                                     }
-                                 }
-                             }
-                         })));
-
-                     const FText DeleteVariableText = FText::Format(INVTEXT("'Fix' - Delete Local Variable - '{0}'"), FText::FromName(LocalVar.VarName));
-                     Message->AddToken(FActionToken::Create(DeleteVariableText, FText::FromString(""),
-                         FSimpleDelegate::CreateLambda([=]
-                             {
-                                 if (Blueprint && EntryNode)
-                                 {
-                                     UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                     AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                     FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-                                         {
-                                             if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-                                             {
-                                                 if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                                 {
-                                                     if(BlueprintEditor->GetMyBlueprintWidget().IsValid())
-                                                     {
-                                                         int32 IndexToRemove = INDEX_NONE;
-                                                         for(int32 i = 0; i < EntryNode->LocalVariables.Num(); ++i)
-                                                         {
-                                                             if(EntryNode->LocalVariables[i].VarName == LocalVar.VarName)
-                                                             {
-                                                                 IndexToRemove = i;
-                                                                 break;
-                                                             }
-                                                         }
-
-                                                         if(IndexToRemove != INDEX_NONE)
-                                                         {
-                                                             const FText ConfirmText = FText::Format(
-                                                                 INVTEXT("Are you sure you want to delete the dispatcher '{0}' from Blueprint '{1}'?"),
-                                                                 FText::FromName(LocalVar.VarName),
-                                                                 FText::FromString(Blueprint->GetName())
-                                                             );
-
-                                                             if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-                                                             {
-                                                                 EntryNode->Modify();
-                                                                 EntryNode->LocalVariables.RemoveAt(IndexToRemove);
-                                                                 FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-                                                             }
-                                                         }
-
-                                                         return false;
-                                                     }
-                                                 }
-                                             }
-
-                                             return true;
-                                         }));
-                                 }
-                             })));
-
-
-                     bIsError = true;
+                     ReportIssue(Context, MakeIssue(TEXT("UnusedLocalVariable"), EMessageSeverity::Warning, Blueprint, LocalVar.VarName, Graph));
                  }
              }
         }
@@ -180,3 +84,45 @@ EDataValidationResult ULocalVariableNeverUsedValidator::ValidateLoadedAsset_Impl
    
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText ULocalVariableNeverUsedValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("Local variable '{0}' in function '{1}' is never used."),
+        Issue.GetMemberText(),
+        Issue.GetGraphText());
+}
+
+void ULocalVariableNeverUsedValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+    Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+    const FText DeleteVariableText = FText::Format(INVTEXT("'Fix' - Delete Local Variable - '{0}'"), Issue.GetMemberText());
+    const FText ConfirmText = FText::Format(
+        INVTEXT("Are you sure you want to delete the local variable '{0}' from function '{1}'?"),
+        Issue.GetMemberText(),
+        Issue.GetGraphText()
+    );
+
+    Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteVariableText, ConfirmText, [GraphName = Issue.GraphName, VarName = Issue.MemberName] (UBlueprint* Blueprint)
+        {
+            for(UEdGraph* Graph : Blueprint->FunctionGraphs)
+            {
+                if(!Graph || Graph->GetFName() != GraphName) continue;
+
+                TArray<UK2Node_FunctionEntry*> EntryNodes;
+                Graph->GetNodesOfClass<UK2Node_FunctionEntry>(EntryNodes);
+                for(UK2Node_FunctionEntry* EntryNode : EntryNodes)
+                {
+                    const int32 IndexToRemove = EntryNode->LocalVariables.IndexOfByPredicate([VarName] (const FBPVariableDescription& LocalVar) { return LocalVar.VarName == VarName; });
+                    if(IndexToRemove != INDEX_NONE)
+                    {
+                        EntryNode->Modify();
+                        EntryNode->LocalVariables.RemoveAt(IndexToRemove);
+                        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+                        return;
+                    }
+                }
+            }
+        }));
+}
@@ -2,10 +2,9 @@
 
 
 #include "Validators/LongFunctionValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_FunctionResult.h"
-#include "Subsystems/AssetEditorSubsystem.h"
-#include "BlueprintEditorModule.h"
 #include "Misc/DataValidation.h"
 
 
@@ -25,26 +24,20 @@ namespace ValidatorX
     }
 }
 
-ULongFunctionValidator::ULongFunctionValidator()
-{
-    SetValidationEnabled(true);
-}
-
 bool ULongFunctionValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool ULongFunctionValidator::IsEnabled() const
+bool ULongFunctionValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    static const ULongFunctionValidator* CDO = GetDefault<ULongFunctionValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
 }
 
 EDataValidationResult ULongFunctionValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
     constexpr int32 NodeLimit = 50;
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -72,42 +65,33 @@ EDataValidationResult ULongFunctionValidator::ValidateLoadedAsset_Implementation
 
             if(NodeCount > NodeLimit)
             {
-                const FString GraphType = ValidatorX::GetGraphType(Blueprint, Graph);
-                const FText MessageText = FText::Format(
-                    INVTEXT("'{0}' - '{1}' contains {2} nodes, which exceeds the recommended limit of {3}. Consider splitting it into smaller functions."),
-                    FText::FromString(GraphType),
-                    FText::FromString(Graph->GetName()),
-                    FText::AsNumber(NodeCount),
-                    FText::AsNumber(NodeLimit)
-                );
-                const FText JumpText = FText::Format(INVTEXT("Jump to '{0}' - {1}"), FText::FromString(Graph->GetName()), FText::FromString(GraphType));
-
-                TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-                Message->AddToken(FActionToken::Create(
-                    JumpText,
-                    FText::FromString(""),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint && Graph)
-                            {
-                                if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-                                {
-                                    AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-                                    if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                    {
-                                        if(IBlueprintEditor* BlueprintEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
-                                        {
-                                            BlueprintEditor->OpenGraphAndBringToFront(Graph, true);
-                                        }
-                                    }
-                                }
-                            }
-                        })));
-                bIsError = true;
+                ReportIssue(Context, MakeIssue(TEXT("LongGraph"), EMessageSeverity::Warning, Blueprint, NAME_None, Graph)
+                    .Add(FName(*ValidatorX::GetGraphType(Blueprint, Graph)))
+                    .Add(NodeCount)
+                    .Add(NodeLimit));
 			}
 		}
 	}
 
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText ULongFunctionValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("'{0}' - '{1}' contains {2} nodes, which exceeds the recommended limit of {3}. Consider splitting it into smaller functions."),
+        Issue.GetArg(0),
+        Issue.GetGraphText(),
+        Issue.GetArg(1),
+        Issue.GetArg(2)
+    );
+}
+
+void ULongFunctionValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+    const FText JumpText = FText::Format(INVTEXT("Jump to '{0}' - {1}"), Issue.GetGraphText(), Issue.GetArg(0));
+    Message.AddToken(FActionToken::Create(JumpText, FText::GetEmpty(), FSimpleDelegate::CreateLambda([Issue]
+        {
+            ValidatorX::JumpToIssue(Issue);
+        })));
+}
@@ -0,0 +1,324 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/LoopNestingValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintCostModel.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Analysis/ExecControlFlowGraph.h"
+#include "K2Node_CallArrayFunction.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_MacroInstance.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	/** Kind of a reported loop, recorded with the issue */
+	enum class ELoopKind : uint8
+	{
+		Loop,
+		ArrayLoop,
+		DelayLoop,
+		ExecCycle
+	};
+
+	bool IsLinearArraySearch(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallArrayFunction* ArrayCall = Cast<UK2Node_CallArrayFunction>(Node);
+		if(!ArrayCall)
+		{
+			return false;
+		}
+
+		const FName FunctionName = ArrayCall->FunctionReference.GetMemberName();
+		return FunctionName == TEXT("Array_Find")
+			|| FunctionName == TEXT("Array_Contains")
+			|| FunctionName == TEXT("Array_Remove")
+			|| FunctionName == TEXT("Array_RemoveItem")
+			|| FunctionName == TEXT("Array_AddUnique");
+	}
+
+	bool IsDelayNode(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		if(!CallNode)
+		{
+			return false;
+		}
+
+		const FName FunctionName = CallNode->FunctionReference.GetMemberName();
+		return FunctionName == TEXT("Delay") || FunctionName == TEXT("RetriggerableDelay");
+	}
+
+	/** Loop depth of a pure node is the deepest loop depth of the exec nodes consuming its value */
+	int32 GetPureNodeLoopDepth(const UEdGraphNode* PureNode, const FValidatorXExecGraph& ExecGraph, const TArray<int32>& LoopDepths)
+	{
+		int32 Depth = 0;
+		TSet<const UEdGraphNode*> Visited;
+		TArray<const UEdGraphNode*> Stack;
+		Stack.Push(PureNode);
+		Visited.Add(PureNode);
+
+		while(Stack.Num() > 0)
+		{
+			const UEdGraphNode* Node = Stack.Pop();
+			for(const UEdGraphPin* Pin : Node->Pins)
+			{
+				if(!Pin || Pin->Direction != EGPD_Output) continue;
+
+				for(const UEdGraphPin* LinkedPin : Pin->LinkedTo)
+				{
+					const UEdGraphNode* Consumer = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+					if(!Consumer || Visited.Contains(Consumer)) continue;
+					Visited.Add(Consumer);
+
+					const int32 ConsumerIndex = ExecGraph.FindIndex(Consumer);
+					if(ConsumerIndex != INDEX_NONE)
+					{
+						Depth = FMath::Max(Depth, LoopDepths[ConsumerIndex]);
+					}
+					else
+					{
+						Stack.Push(Consumer);
+					}
+				}
+			}
+		}
+
+		return Depth;
+	}
+}
+
+bool ULoopNestingValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+bool ULoopNestingValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
+}
+
+EDataValidationResult ULoopNestingValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		TArray<UEdGraph*> AllGraphs = Blueprint->UbergraphPages;
+		AllGraphs.Append(Blueprint->FunctionGraphs);
+		AllGraphs.Append(Blueprint->MacroGraphs);
+
+		for(UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			FValidatorXExecGraph ExecGraph;
+			ExecGraph.Build(Graph);
+
+			const int32 NumNodes = ExecGraph.Num();
+			if(NumNodes <= 1)
+			{
+				continue;
+			}
+
+			TArray<int32> ImmediateDominators;
+			ExecGraph.ComputeDominators(ImmediateDominators);
+
+			struct FLoop
+			{
+				int32 NodeIndex = INDEX_NONE;
+				bool bIsMacroLoop = false;
+				bool bIsArrayLoop = false;
+				bool bUsesDelay = false;
+			};
+			TArray<FLoop> Loops;
+
+			// Macro loops: a node is in the body when the node right after the LoopBody pin dominates it
+			TArray<int32> BodyEntryCounts;
+			BodyEntryCounts.Init(0, NumNodes);
+			for(int32 Index = 1; Index < NumNodes; ++Index)
+			{
+				UEdGraphNode* Node = ExecGraph.Nodes[Index];
+				if(!ValidatorX::IsLoopMacroNode(Node)) continue;
+
+				FLoop& Loop = Loops.AddDefaulted_GetRef();
+				Loop.NodeIndex = Index;
+				Loop.bIsMacroLoop = true;
+				Loop.bIsArrayLoop = CastChecked<UK2Node_MacroInstance>(Node)->GetMacroGraph()->GetName().Contains(TEXT("ForEach"));
+
+				if(const UEdGraphPin* BodyPin = Node->FindPin(TEXT("LoopBody")))
+				{
+					for(const UEdGraphPin* LinkedPin : BodyPin->LinkedTo)
+					{
+						const int32 BodyEntry = LinkedPin ? ExecGraph.FindIndex(LinkedPin->GetOwningNode()) : INDEX_NONE;
+						if(BodyEntry != INDEX_NONE && ImmediateDominators[BodyEntry] == Index)
+						{
+							BodyEntryCounts[BodyEntry]++;
+						}
+					}
+				}
+			}
+
+			// Depth along the dominator tree: entering a body entry opens one more loop level
+			TArray<TArray<int32>> DominatorChildren;
+			DominatorChildren.SetNum(NumNodes);
+			for(int32 Index = 1; Index < NumNodes; ++Index)
+			{
+				if(ImmediateDominators[Index] != INDEX_NONE)
+				{
+					DominatorChildren[ImmediateDominators[Index]].Add(Index);
+				}
+			}
+
+			TArray<int32> LoopDepths;
+			LoopDepths.Init(0, NumNodes);
+			TArray<int32> Stack;
+			Stack.Push(FValidatorXExecGraph::RootIndex);
+			while(Stack.Num() > 0)
+			{
+				const int32 Index = Stack.Pop();
+				for(const int32 Child : DominatorChildren[Index])
+				{
+					LoopDepths[Child] = LoopDepths[Index] + BodyEntryCounts[Child];
+					Stack.Push(Child);
+				}
+			}
+
+			// Natural loops from back edges (event/Delay loops and manual exec cycles), merged per header
+			auto Dominates = [&ImmediateDominators] (int32 Dominator, int32 Node)
+				{
+					while(Node != INDEX_NONE && Node != FValidatorXExecGraph::RootIndex)
+					{
+						if(Node == Dominator)
+						{
+							return true;
+						}
+						Node = ImmediateDominators[Node];
+					}
+					return false;
+				};
+
+			TMap<int32, TSet<int32>> NaturalLoopBodies;
+			for(int32 Index = 1; Index < NumNodes; ++Index)
+			{
+				if(ImmediateDominators[Index] == INDEX_NONE) continue;
+
+				for(const int32 Successor : ExecGraph.Successors[Index])
+				{
+					if(Dominates(Successor, Index))
+					{
+						TArray<int32> Body;
+						ExecGraph.CollectNaturalLoop(Successor, Index, Body);
+						NaturalLoopBodies.FindOrAdd(Successor).Append(Body);
+					}
+				}
+			}
+
+			for(const TPair<int32, TSet<int32>>& Pair : NaturalLoopBodies)
+			{
+				FLoop& Loop = Loops.AddDefaulted_GetRef();
+				Loop.NodeIndex = Pair.Key;
+
+				for(const int32 BodyIndex : Pair.Value)
+				{
+					LoopDepths[BodyIndex]++;
+					Loop.bUsesDelay |= ValidatorX::IsDelayNode(ExecGraph.Nodes[BodyIndex]);
+				}
+			}
+
+			for(const FLoop& Loop : Loops)
+			{
+				UEdGraphNode* LoopNode = ExecGraph.Nodes[Loop.NodeIndex];
+
+				// A natural loop header is part of its own body
+				const int32 EnclosingDepth = LoopDepths[Loop.NodeIndex] - (Loop.bIsMacroLoop ? 0 : 1);
+				const int32 Depth = EnclosingDepth + 1;
+				if(Depth <= MaxLoopDepth)
+				{
+					continue;
+				}
+
+				ValidatorX::ELoopKind Kind = ValidatorX::ELoopKind::Loop;
+				if(Loop.bIsArrayLoop)
+				{
+					Kind = ValidatorX::ELoopKind::ArrayLoop;
+				}
+				else if(!Loop.bIsMacroLoop)
+				{
+					Kind = Loop.bUsesDelay ? ValidatorX::ELoopKind::DelayLoop : ValidatorX::ELoopKind::ExecCycle;
+				}
+
+				ReportIssue(Context, MakeIssue(TEXT("NestedLoop"), EMessageSeverity::Warning, Blueprint, LoopNode)
+					.Add(static_cast<int32>(Kind))
+					.Add(Depth));
+			}
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(!Node) continue;
+
+				const int32 NodeIndex = ExecGraph.FindIndex(Node);
+				const bool bIsSearch = ValidatorX::IsLinearArraySearch(Node);
+				const bool bIsCreation = NodeIndex != INDEX_NONE && ValidatorX::IsObjectCreationNode(Node);
+				if(!bIsSearch && !bIsCreation)
+				{
+					continue;
+				}
+
+				const int32 Depth = NodeIndex != INDEX_NONE
+					? LoopDepths[NodeIndex]
+					: ValidatorX::GetPureNodeLoopDepth(Node, ExecGraph, LoopDepths);
+				if(Depth == 0)
+				{
+					continue;
+				}
+
+				ReportIssue(Context, MakeIssue(bIsSearch ? TEXT("SearchInLoop") : TEXT("CreationInLoop"), EMessageSeverity::Warning, Blueprint, Node)
+					.Add(Depth));
+			}
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText ULoopNestingValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("NestedLoop"))
+	{
+		FText Kind = INVTEXT("Loop");
+		switch(static_cast<ValidatorX::ELoopKind>(Issue.GetNumberArg(0)))
+		{
+		case ValidatorX::ELoopKind::ArrayLoop:
+			Kind = INVTEXT("Array loop");
+			break;
+		case ValidatorX::ELoopKind::DelayLoop:
+			Kind = INVTEXT("Event/Delay loop");
+			break;
+		case ValidatorX::ELoopKind::ExecCycle:
+			Kind = INVTEXT("Exec cycle");
+			break;
+		default:
+			break;
+		}
+
+		return FText::Format(
+			INVTEXT("{0} '{1}' in graph '{2}' is nested at depth {3}. Nested loops over arrays grow quadratically; precompute a Map/Set lookup or flatten the iteration."),
+			Kind,
+			Issue.GetNodeTitle(),
+			Issue.GetGraphText(),
+			Issue.GetArg(1)
+		);
+	}
+
+	return FText::Format(
+		Issue.RuleId == TEXT("SearchInLoop")
+			? INVTEXT("'{0}' in graph '{1}' runs inside a loop (depth {2}). It scans the whole array each time, making the loop O(n²); use a Set or Map for lookups.")
+			: INVTEXT("'{0}' in graph '{1}' creates objects inside a loop (depth {2}). This is a pooling candidate: create once and reuse."),
+		Issue.GetNodeTitle(),
+		Issue.GetGraphText(),
+		Issue.GetArg(0)
+	);
+}
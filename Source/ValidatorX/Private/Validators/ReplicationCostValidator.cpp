@@ -0,0 +1,263 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/ReplicationCostValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "K2Node_CallArrayFunction.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_Event.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	int32 EstimateReplicatedBytes(const FProperty* Property, const UObject* DefaultObject)
+	{
+		if(!Property)
+		{
+			return 0;
+		}
+
+		if(const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+		{
+			int32 NumElements = 1;
+			if(DefaultObject)
+			{
+				FScriptArrayHelper_InContainer ArrayHelper(ArrayProperty, DefaultObject);
+				NumElements = FMath::Max(1, ArrayHelper.Num());
+			}
+			return ArrayProperty->Inner->GetSize() * NumElements;
+		}
+
+		return Property->GetSize();
+	}
+
+	FString GetRpcKindName(uint32 FunctionFlags)
+	{
+		const TCHAR* Reliability = (FunctionFlags & FUNC_NetReliable) ? TEXT("Reliable") : TEXT("Unreliable");
+		if(FunctionFlags & FUNC_NetMulticast) return FString::Printf(TEXT("%s Multicast"), Reliability);
+		if(FunctionFlags & FUNC_NetClient) return FString::Printf(TEXT("%s Client"), Reliability);
+		if(FunctionFlags & FUNC_NetServer) return FString::Printf(TEXT("%s Server"), Reliability);
+		return FString(Reliability);
+	}
+}
+
+bool UReplicationCostValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UReplicationCostValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return Super::CanValidateAssetData(InAssetData) && (ValidatorX::IsNativeParentChildOf(InAssetData, AActor::StaticClass()) || ValidatorX::IsNativeParentChildOf(InAssetData, UActorComponent::StaticClass()));
+}
+
+EDataValidationResult UReplicationCostValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		const UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject(false) : nullptr;
+
+		TMap<FName, const FBPVariableDescription*> ReplicatedVariables;
+		int32 ReplicatedBytes = 0;
+		int32 RepNotifyCount = 0;
+		for(const FBPVariableDescription& Variable : Blueprint->NewVariables)
+		{
+			if((Variable.PropertyFlags & CPF_Net) == 0)
+			{
+				continue;
+			}
+
+			ReplicatedVariables.Add(Variable.VarName, &Variable);
+			ReplicatedBytes += ValidatorX::EstimateReplicatedBytes(FindFProperty<FProperty>(Blueprint->GeneratedClass, Variable.VarName), DefaultObject);
+			if(Variable.RepNotifyFunc != NAME_None)
+			{
+				RepNotifyCount++;
+			}
+		}
+
+		TMap<FName, const UK2Node_CustomEvent*> RpcEvents;
+		int32 ReliableRpcCount = 0;
+		TArray<UEdGraph*> AllGraphs;
+		Blueprint->GetAllGraphs(AllGraphs);
+		for(UEdGraph* Graph : AllGraphs)
+		{
+			if(!Graph) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				const UK2Node_CustomEvent* CustomEvent = Cast<UK2Node_CustomEvent>(Node);
+				if(CustomEvent && (CustomEvent->FunctionFlags & FUNC_Net))
+				{
+					RpcEvents.Add(CustomEvent->CustomFunctionName, CustomEvent);
+					if(CustomEvent->FunctionFlags & FUNC_NetReliable)
+					{
+						ReliableRpcCount++;
+					}
+				}
+			}
+		}
+
+		if(ReplicatedVariables.Num() == 0 && RpcEvents.Num() == 0)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		TSet<UEdGraphNode*> TickNodes;
+		if(UK2Node_Event* TickEvent = ValidatorX::FindEventNode(Blueprint, FName(TEXT("ReceiveTick"))))
+		{
+			UEdGraphNode* Roots[] = { TickEvent };
+			ValidatorX::CollectExecReachableNodes(Blueprint, Roots, TickNodes);
+		}
+
+		for(UEdGraphNode* Node : TickNodes)
+		{
+			if(const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				const UK2Node_CustomEvent* const* RpcEvent = RpcEvents.Find(CallNode->FunctionReference.GetMemberName());
+				if(RpcEvent)
+				{
+					const uint32 Flags = (*RpcEvent)->FunctionFlags;
+					if((Flags & FUNC_NetReliable) && (Flags & (FUNC_NetMulticast | FUNC_NetClient)))
+					{
+						ReportIssue(Context, MakeIssue(TEXT("ReliableRpcInTick"), EMessageSeverity::Warning, Blueprint, CallNode)
+							.Add(static_cast<int64>(Flags))
+							.Add((*RpcEvent)->CustomFunctionName));
+					}
+				}
+			}
+
+			FName WrittenVariable = NAME_None;
+			if(const UK2Node_VariableSet* VarSet = Cast<UK2Node_VariableSet>(Node))
+			{
+				WrittenVariable = VarSet->GetVarName();
+			}
+			else if(const UK2Node_CallArrayFunction* ArrayCall = Cast<UK2Node_CallArrayFunction>(Node))
+			{
+				const UEdGraphPin* TargetArrayPin = ArrayCall->GetTargetArrayPin();
+				if(!ArrayCall->IsNodePure() && TargetArrayPin && TargetArrayPin->LinkedTo.Num() > 0)
+				{
+					if(const UK2Node_VariableGet* ArrayGet = Cast<UK2Node_VariableGet>(TargetArrayPin->LinkedTo[0]->GetOwningNode()))
+					{
+						WrittenVariable = ArrayGet->GetVarName();
+					}
+				}
+			}
+
+			if(const FBPVariableDescription* const* Variable = ReplicatedVariables.Find(WrittenVariable))
+			{
+				const FEdGraphPinType& VarType = (*Variable)->VarType;
+				if(VarType.IsContainer() || VarType.PinCategory == UEdGraphSchema_K2::PC_Struct)
+				{
+					ReportIssue(Context, MakeIssue(TEXT("ReplicatedWriteInTick"), EMessageSeverity::Warning, Blueprint, Node)
+						.Add(VarType.IsContainer() ? 1 : 0)
+						.Add(WrittenVariable));
+				}
+			}
+		}
+
+		if(const AActor* ActorDefault = Cast<AActor>(DefaultObject))
+		{
+			const FActorTickFunction& TickFunction = ActorDefault->PrimaryActorTick;
+			if(TickFunction.bCanEverTick && TickFunction.TickInterval <= FrequentTickInterval)
+			{
+				TArray<FString> UnconditionedNames;
+				for(const TPair<FName, const FBPVariableDescription*>& Pair : ReplicatedVariables)
+				{
+					if(Pair.Value->ReplicationCondition == COND_None)
+					{
+						UnconditionedNames.Add(Pair.Key.ToString());
+					}
+				}
+
+				if(UnconditionedNames.Num() > 0)
+				{
+					ReportIssue(Context, MakeIssue(TEXT("UnconditionedReplication"), EMessageSeverity::Warning, Blueprint)
+						.Add(TickFunction.TickInterval)
+						.Add(UnconditionedNames.Num())
+						.Add(FString::Join(UnconditionedNames, TEXT(", "))));
+				}
+			}
+		}
+
+		if(bIsError || bAlwaysReportFootprint)
+		{
+			ReportIssue(Context, MakeIssue(TEXT("ReplicationFootprint"), EMessageSeverity::Info, Blueprint)
+				.Add(ReplicatedVariables.Num())
+				.Add(FValidatorXIssueArg::Bytes(ReplicatedBytes))
+				.Add(RepNotifyCount)
+				.Add(RpcEvents.Num())
+				.Add(ReliableRpcCount));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UReplicationCostValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("ReliableRpcInTick"))
+	{
+		return FText::Format(
+			INVTEXT("{0} RPC '{1}' is called every frame from Tick in Blueprint '{2}'. Reliable RPCs sent per frame saturate the reliable buffer; make it unreliable or send it on change."),
+			FText::FromString(ValidatorX::GetRpcKindName(static_cast<uint32>(Issue.GetNumberArg(0)))),
+			Issue.GetArg(1),
+			Issue.GetAssetText()
+		);
+	}
+
+	if(Issue.RuleId == TEXT("ReplicatedWriteInTick"))
+	{
+		return FText::Format(
+			INVTEXT("Replicated {0} '{1}' is written every frame from Tick in Blueprint '{2}'. Each write re-serializes it for every relevant connection; update it on change or replicate a compact summary instead."),
+			FText::FromString(Issue.GetNumberArg(0) != 0 ? TEXT("container") : TEXT("struct")),
+			Issue.GetArg(1),
+			Issue.GetAssetText()
+		);
+	}
+
+	if(Issue.RuleId == TEXT("UnconditionedReplication"))
+	{
+		return FText::Format(
+			INVTEXT("Blueprint '{0}' ticks every {1}s and replicates {2} properties without a replication condition ({3}). Consider conditions such as OwnerOnly, SkipOwner or InitialOnly."),
+			Issue.GetAssetText(),
+			Issue.GetArg(0),
+			Issue.GetArg(1),
+			Issue.GetArg(2)
+		);
+	}
+
+	return FText::Format(
+		INVTEXT("Replication footprint of '{0}': {1} replicated properties (~{2} per full update, {3} with RepNotify), {4} RPC events ({5} reliable)."),
+		Issue.GetAssetText(),
+		Issue.GetArg(0),
+		Issue.GetArg(1),
+		Issue.GetArg(2),
+		Issue.GetArg(3),
+		Issue.GetArg(4)
+	);
+}
+
+void UReplicationCostValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	if(!Issue.NodeGuid.IsValid())
+	{
+		return;
+	}
+
+	Message.AddToken(FActionToken::Create(
+		Issue.RuleId == TEXT("ReliableRpcInTick") ? FText::FromString("Jump to call") : FText::FromString("Jump to node"),
+		FText::GetEmpty(),
+		FSimpleDelegate::CreateLambda([Issue]
+			{
+				ValidatorX::JumpToIssue(Issue);
+			})
+	));
+}
@@ -0,0 +1,271 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/TickEfficiencyValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
+#include "Analysis/BlueprintCostModel.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "Components/ActorComponent.h"
+#include "Components/LightComponentBase.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Components/Widget.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Event.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_MacroInstance.h"
+#include "K2Node_VariableSet.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	const FTickFunction* GetDefaultTickFunction(const UObject* DefaultObject)
+	{
+		if(const AActor* Actor = Cast<AActor>(DefaultObject))
+		{
+			return &Actor->PrimaryActorTick;
+		}
+		if(const UActorComponent* Component = Cast<UActorComponent>(DefaultObject))
+		{
+			return &Component->PrimaryComponentTick;
+		}
+		return nullptr;
+	}
+
+	bool IsTimePollingNode(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		if(!CallNode)
+		{
+			return false;
+		}
+
+		const FString FunctionName = CallNode->FunctionReference.GetMemberName().ToString();
+		return FunctionName.StartsWith(TEXT("GetTimer"))
+			|| FunctionName.StartsWith(TEXT("IsTimer"))
+			|| FunctionName == TEXT("GetGameTimeInSeconds")
+			|| FunctionName == TEXT("GetRealTimeSeconds")
+			|| FunctionName == TEXT("GetTimeSeconds")
+			|| FunctionName == TEXT("GetAccurateRealTime");
+	}
+
+	/** Setters on components, widgets, lights and dynamic materials only change what is rendered */
+	bool IsCosmeticCall(const UEdGraphNode* Node)
+	{
+		const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+		const UFunction* Function = CallNode ? CallNode->GetTargetFunction() : nullptr;
+		if(!Function)
+		{
+			return false;
+		}
+
+		const FString FunctionName = Function->GetName();
+		if(!FunctionName.StartsWith(TEXT("Set")) && !FunctionName.StartsWith(TEXT("Add")))
+		{
+			return false;
+		}
+
+		const UClass* OwnerClass = Function->GetOwnerClass();
+		return OwnerClass->IsChildOf(USceneComponent::StaticClass())
+			|| OwnerClass->IsChildOf(ULightComponentBase::StaticClass())
+			|| OwnerClass->IsChildOf(UMaterialInstanceDynamic::StaticClass())
+			|| OwnerClass->IsChildOf(UWidget::StaticClass());
+	}
+
+	/** Tick -> Branch with one side empty, or Tick -> Gate/DoOnce: the real work runs rarely but is polled every frame */
+	UEdGraphNode* FindTickGate(const UK2Node_Event* TickEvent)
+	{
+		const UEdGraphPin* ThenPin = TickEvent->FindPin(UEdGraphSchema_K2::PN_Then);
+		if(!ThenPin || ThenPin->LinkedTo.Num() != 1)
+		{
+			return nullptr;
+		}
+
+		UEdGraphNode* FirstNode = ThenPin->LinkedTo[0]->GetOwningNode();
+		if(UK2Node_IfThenElse* Branch = Cast<UK2Node_IfThenElse>(FirstNode))
+		{
+			const bool bThenEmpty = !Branch->GetThenPin() || Branch->GetThenPin()->LinkedTo.Num() == 0;
+			const bool bElseEmpty = !Branch->GetElsePin() || Branch->GetElsePin()->LinkedTo.Num() == 0;
+			return bThenEmpty != bElseEmpty ? Branch : nullptr;
+		}
+
+		if(const UK2Node_MacroInstance* Macro = Cast<UK2Node_MacroInstance>(FirstNode))
+		{
+			const UEdGraph* MacroGraph = Macro->GetMacroGraph();
+			if(MacroGraph && (MacroGraph->GetFName() == TEXT("Gate") || MacroGraph->GetFName() == TEXT("DoOnce")))
+			{
+				return FirstNode;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** DeltaSeconds feeding a math node whose result is stored: a hand-written timer */
+	bool AccumulatesDeltaSeconds(const UK2Node_Event* TickEvent)
+	{
+		const UEdGraphPin* DeltaPin = TickEvent->FindPin(TEXT("DeltaSeconds"));
+		if(!DeltaPin)
+		{
+			return false;
+		}
+
+		for(const UEdGraphPin* LinkedPin : DeltaPin->LinkedTo)
+		{
+			const UEdGraphNode* MathNode = LinkedPin ? LinkedPin->GetOwningNode() : nullptr;
+			if(!MathNode || !MathNode->IsA<UK2Node_CallFunction>())
+			{
+				continue;
+			}
+
+			for(const UEdGraphPin* MathPin : MathNode->Pins)
+			{
+				if(!MathPin || MathPin->Direction != EGPD_Output) continue;
+
+				for(const UEdGraphPin* Consumer : MathPin->LinkedTo)
+				{
+					const UEdGraphNode* ConsumerNode = Consumer ? Consumer->GetOwningNode() : nullptr;
+					if(ConsumerNode && ConsumerNode->IsA<UK2Node_VariableSet>())
+					{
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+}
+
+bool UTickEfficiencyValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UTickEfficiencyValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return Super::CanValidateAssetData(InAssetData) && (ValidatorX::IsNativeParentChildOf(InAssetData, AActor::StaticClass()) || ValidatorX::IsNativeParentChildOf(InAssetData, UActorComponent::StaticClass()));
+}
+
+EDataValidationResult UTickEfficiencyValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
+	{
+		const UObject* DefaultObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject(false) : nullptr;
+		const FTickFunction* TickFunction = ValidatorX::GetDefaultTickFunction(DefaultObject);
+		UK2Node_Event* TickEvent = ValidatorX::FindEventNode(Blueprint, FName(TEXT("ReceiveTick")));
+
+		if(!TickFunction || !TickFunction->bCanEverTick || !TickEvent)
+		{
+			return EDataValidationResult::Valid;
+		}
+
+		TSet<UEdGraphNode*> TickNodes;
+		UEdGraphNode* Roots[] = { TickEvent };
+		ValidatorX::CollectExecReachableNodes(Blueprint, Roots, TickNodes);
+
+		const int32 TickCost = ValidatorX::EstimateNodesCost(TickNodes);
+		const bool bEveryFrame = TickFunction->TickInterval <= 0.0f;
+
+		bool bPollsTime = ValidatorX::AccumulatesDeltaSeconds(TickEvent);
+		int32 CosmeticCalls = 0;
+		int32 OtherCalls = 0;
+		for(const UEdGraphNode* Node : TickNodes)
+		{
+			bPollsTime |= ValidatorX::IsTimePollingNode(Node);
+
+			const UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node);
+			if(CallNode && !CallNode->IsNodePure())
+			{
+				ValidatorX::IsCosmeticCall(Node) ? CosmeticCalls++ : OtherCalls++;
+			}
+		}
+
+		// Tick settings are recorded with every finding, the message explains them
+		auto Report = [&] (UEdGraphNode* Node, FName RuleId)
+			{
+				ReportIssue(Context, MakeIssue(RuleId, EMessageSeverity::Warning, Blueprint, Node)
+					.Add(TickFunction->TickInterval)
+					.Add(TickFunction->bStartWithTickEnabled ? 1 : 0)
+					.Add(TickCost)
+					.Add(bEveryFrame ? 1 : 0));
+			};
+
+		if(UEdGraphNode* Gate = ValidatorX::FindTickGate(TickEvent))
+		{
+			Report(Gate, TEXT("PolledGate"));
+		}
+
+		if(bPollsTime)
+		{
+			Report(TickEvent, TEXT("PolledTime"));
+		}
+
+		if(CosmeticCalls > 0 && OtherCalls == 0)
+		{
+			Report(TickEvent, TEXT("CosmeticTick"));
+		}
+		else if(bEveryFrame && TickCost <= TrivialTickCost)
+		{
+			Report(TickEvent, TEXT("TrivialTick"));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UTickEfficiencyValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	FText Finding = INVTEXT("it does trivial work every frame.");
+	FText Recommendation = INVTEXT("Set a TickInterval or drive the update from the event that changes the data.");
+	if(Issue.RuleId == TEXT("PolledGate"))
+	{
+		Finding = INVTEXT("all of its work is gated behind a condition that is polled every frame.");
+		Recommendation = INVTEXT("Disable tick by default and enable it (or run the work directly) from the event that makes the condition true.");
+	}
+	else if(Issue.RuleId == TEXT("PolledTime"))
+	{
+		Finding = INVTEXT("it polls time or timers to decide when to act.");
+		Recommendation = INVTEXT("Use Set Timer by Event/Function or a Delay instead of counting time in Tick.");
+	}
+	else if(Issue.RuleId == TEXT("CosmeticTick"))
+	{
+		Finding = INVTEXT("it only updates cosmetic state (transforms, materials, lights or widgets).");
+		Recommendation = Issue.GetNumberArg(3) != 0
+			? INVTEXT("Raise TickInterval, or move the effect to a Timeline, material animation or movement component.")
+			: INVTEXT("Consider a Timeline, material animation or movement component.");
+	}
+
+	const FText Settings = FText::Format(
+		INVTEXT("(TickInterval {0}s, start enabled: {1}, estimated cost per tick {2})"),
+		Issue.GetArg(0),
+		FText::FromString(Issue.GetNumberArg(1) != 0 ? TEXT("true") : TEXT("false")),
+		Issue.GetArg(2)
+	);
+
+	return FText::Format(
+		INVTEXT("'{0}' ticks {1}: {2} {3}"),
+		Issue.GetAssetText(),
+		Settings,
+		Finding,
+		Recommendation
+	);
+}
+
+void UTickEfficiencyValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	if(!Issue.NodeGuid.IsValid())
+	{
+		return;
+	}
+
+	Message.AddToken(FActionToken::Create(FText::FromString("Jump to Tick"), FText::GetEmpty(),
+		FSimpleDelegate::CreateLambda([Issue]
+			{
+				ValidatorX::JumpToIssue(Issue);
+			})
+	));
+}
@@ -2,6 +2,7 @@
 
 
 #include "Validators/UnboundEventDispatcherValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "K2Node_AddDelegate.h"
 #include "K2Node_RemoveDelegate.h"
@@ -15,29 +16,20 @@
 #include "AssetToolsModule.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "Misc/DataValidation.h"
-#include "BlueprintEditorModule.h"
-#include "BlueprintEditor.h"
-#include "SMyBlueprint.h"
-
-UUnboundEventDispatcherValidator::UUnboundEventDispatcherValidator()
-{
-    SetValidationEnabled(true);
-}
 
 bool UUnboundEventDispatcherValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-    return InAsset && InAsset->IsA<UBlueprint>();
+    return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UUnboundEventDispatcherValidator::IsEnabled() const
+bool UUnboundEventDispatcherValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    static const UUnboundEventDispatcherValidator* CDO = GetDefault<UUnboundEventDispatcherValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+    return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumDispatchers) != 0;
 }
 
 EDataValidationResult UUnboundEventDispatcherValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -97,93 +89,42 @@ EDataValidationResult UUnboundEventDispatcherValidator::ValidateLoadedAsset_Impl
         {
             if(!UsedDispatchers.Contains(Dispatcher))
             {
-                const FText MessageText = FText::Format(
-                    INVTEXT("Event Dispatcher '{0}' is never bound, assigned or called in Blueprint '{1}'."),
-                    FText::FromName(Dispatcher),
-                    FText::FromString(Blueprint->GetName())
-                );
-
-                TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-                FText JumpToDispatcherText = FText::Format(INVTEXT("Jump to Dispatcher - '{0}'    "), FText::FromName(Dispatcher));
-                Message->AddToken(FActionToken::Create(JumpToDispatcherText, FText::FromString(""),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint)
-                            {
-                                UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                {
-                                    if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                    {
-                                        if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-                                        {
-                                            MyBlueprintWidget->SelectItemByName(Dispatcher, 
-                                                ESelectInfo::Direct, 
-                                                INDEX_NONE, 
-                                                false);
-                                        }
-                                    }
-                                }
-                            }                        
-                        })
-                ));
-
-                FText DeleteDispatcherText = FText::Format(INVTEXT("'Fix' - Delete Dispatcher - '{0}'"), FText::FromName(Dispatcher));
-                Message->AddToken(FActionToken::Create(DeleteDispatcherText, FText::FromString(""),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint)
-                            {
-                                UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-                                AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-                                    {
-                                        if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, /*bFocusIfOpen=*/false))
-                                        {
-                                            if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                            {
-                                                if(BlueprintEditor->GetMyBlueprintWidget().IsValid())
-                                                {
-                                                    int32 IndexToRemove = INDEX_NONE;
-                                                    for(int32 i = 0; i < Blueprint->NewVariables.Num(); ++i)
-                                                    {
-                                                        if(Blueprint->NewVariables[i].VarName == Dispatcher)
-                                                        {
-                                                            IndexToRemove = i;
-                                                            break;
-                                                        }
-                                                    }
-
-                                                    if(IndexToRemove != INDEX_NONE)
-                                                    {
-                                                        const FText ConfirmText = FText::Format(
-                                                            INVTEXT("Are you sure you want to delete the dispatcher '{0}' from Blueprint '{1}'?"),
-                                                            FText::FromName(Dispatcher),
-                                                            FText::FromString(Blueprint->GetName())
-                                                        );
-
-                                                        if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-                                                        {
-                                                            Blueprint->Modify();
-                                                            Blueprint->NewVariables.RemoveAt(IndexToRemove);
-                                                            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-                                                        }
-                                                    }
-
-                                                    return false; 
-                                                }
-                                            }
-                                        }
-                                        return true;
-                                    }));
-                            }
-                        })
-                ));
-                bIsError = true;
+                ReportIssue(Context, MakeIssue(TEXT("UnboundDispatcher"), EMessageSeverity::Warning, Blueprint, Dispatcher));
             }
         }
     }
 
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText UUnboundEventDispatcherValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("Event Dispatcher '{0}' is never bound, assigned or called in Blueprint '{1}'."),
+        Issue.GetMemberText(),
+        Issue.GetAssetText()
+    );
+}
+
+void UUnboundEventDispatcherValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+    Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+    const FText DeleteDispatcherText = FText::Format(INVTEXT("'Fix' - Delete Dispatcher - '{0}'"), Issue.GetMemberText());
+    const FText ConfirmText = FText::Format(
+        INVTEXT("Are you sure you want to delete the dispatcher '{0}' from Blueprint '{1}'?"),
+        Issue.GetMemberText(),
+        Issue.GetAssetText()
+    );
+
+    Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteDispatcherText, ConfirmText, [Dispatcher = Issue.MemberName] (UBlueprint* Blueprint)
+        {
+            const int32 IndexToRemove = Blueprint->NewVariables.IndexOfByPredicate([Dispatcher] (const FBPVariableDescription& Variable) { return Variable.VarName == Dispatcher; });
+            if(IndexToRemove != INDEX_NONE)
+            {
+                Blueprint->Modify();
+                Blueprint->NewVariables.RemoveAt(IndexToRemove);
+                FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+            }
+        }));
+}
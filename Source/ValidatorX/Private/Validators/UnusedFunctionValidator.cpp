@@ -2,31 +2,24 @@
 
 
 #include "Validators/UnusedFunctionValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_CallFunction.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "BlueprintEditor.h"
 #include "Misc/DataValidation.h"
-#include "SMyBlueprint.h"
-UUnusedFunctionValidator::UUnusedFunctionValidator()
-{
-    SetValidationEnabled(true);
-}
-
 bool UUnusedFunctionValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UUnusedFunctionValidator::IsEnabled() const
+bool UUnusedFunctionValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-    static const UUnusedFunctionValidator* CDO = GetDefault<UUnusedFunctionValidator>();
-    return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumFunctions) != 0;
 }
 
 EDataValidationResult UUnusedFunctionValidator::ValidateLoadedAsset_Implementation(
     const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-    bIsError = false;
+    const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
     if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
     {
@@ -75,92 +68,49 @@ EDataValidationResult UUnusedFunctionValidator::ValidateLoadedAsset_Implementati
 
             if(!bIsFunctionUsed)
             {
-                const FText MessageText = FText::Format(
-                    INVTEXT("Function '{0}' in Blueprint '{1}' is never used."),
-                    FText::FromName(FunctionName),
-                    FText::FromString(Blueprint->GetName())
-                );
-
-                const TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-
-                const FText JumpToFunctionText = FText::Format(
-                    INVTEXT("Jump to Function - '{0}'"),
-                    FText::FromName(FunctionName));
-
-                Message->AddToken(FActionToken::Create(JumpToFunctionText, FText::GetEmpty(),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint && FunctionGraph)
-                            {
-                                if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-                                {
-                                    AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-                                    if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                    {
-                                        if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                        {
-                                            BlueprintEditor->OpenGraphAndBringToFront(FunctionGraph, true);
-
-                                            if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-                                            {
-                                                MyBlueprintWidget->SelectItemByName(FunctionGraph->GetFName(),
-                                                    ESelectInfo::Direct,
-                                                    INDEX_NONE,
-                                                    false);
-                                            }
-                                        }
-                                    }
-                                }
-                            }
-                        })));
-
-                const FText DeleteFunctionText = FText::Format(
-                    INVTEXT("'Fix' - Delete Function - '{0}'"),
-                    FText::FromName(FunctionName));
-
-                Message->AddToken(FActionToken::Create(DeleteFunctionText, FText::GetEmpty(),
-                    FSimpleDelegate::CreateLambda([=]
-                        {
-                            if(Blueprint && FunctionGraph)
-                            {
-                                if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-                                {
-                                    AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-                                    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-                                        {
-                                            if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-                                            {
-                                                if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-                                                {
-                                                    const FText ConfirmText = FText::Format(
-                                                        INVTEXT("Are you sure you want to delete the unused Function '{0}' from Blueprint '{1}'?"),
-                                                        FText::FromName(FunctionName),
-                                                        FText::FromString(Blueprint->GetName())
-                                                    );
-
-                                                    if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-                                                    {
-                                                        Blueprint->Modify();
-
-                                                        Blueprint->FunctionGraphs.Remove(FunctionGraph);
-                                                        FunctionGraph->Modify();
-                                                        FunctionGraph->MarkAsGarbage();
-
-                                                        FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-                                                    }
-                                                }
-                                            }
-                                            return false;
-                                        }));
-                                }
-                            }
-                        })));
-
-                bIsError = true;
+                ReportIssue(Context, MakeIssue(TEXT("UnusedFunction"), EMessageSeverity::Warning, Blueprint, NAME_None, FunctionGraph));
             }
         }
     }
 
     return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText UUnusedFunctionValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+    return FText::Format(
+        INVTEXT("Function '{0}' in Blueprint '{1}' is never used."),
+        Issue.GetGraphText(),
+        Issue.GetAssetText()
+    );
+}
+
+void UUnusedFunctionValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+    Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+    const FText DeleteFunctionText = FText::Format(INVTEXT("'Fix' - Delete Function - '{0}'"), Issue.GetGraphText());
+    const FText ConfirmText = FText::Format(
+        INVTEXT("Are you sure you want to delete the unused Function '{0}' from Blueprint '{1}'?"),
+        Issue.GetGraphText(),
+        Issue.GetAssetText()
+    );
+
+    Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteFunctionText, ConfirmText, [GraphName = Issue.GraphName] (UBlueprint* Blueprint)
+        {
+            const TObjectPtr<UEdGraph>* Found = Blueprint->FunctionGraphs.FindByPredicate([GraphName] (const UEdGraph* Graph) { return Graph && Graph->GetFName() == GraphName; });
+            if(!Found)
+            {
+                return;
+            }
+
+            UEdGraph* FunctionGraph = *Found;
+            Blueprint->Modify();
+
+            Blueprint->FunctionGraphs.Remove(FunctionGraph);
+            FunctionGraph->Modify();
+            FunctionGraph->MarkAsGarbage();
+
+            FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+        }));
+}
@@ -2,30 +2,23 @@
 
 
 #include "Validators/UnusedMacroValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "K2Node_MacroInstance.h"
 #include "Kismet2/BlueprintEditorUtils.h"
-#include "BlueprintEditor.h"
 #include "Misc/DataValidation.h"
-#include "SMyBlueprint.h"
-UUnusedMacroValidator::UUnusedMacroValidator()
-{
-	SetValidationEnabled(true);
-}
-
 bool UUnusedMacroValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(InContext);
 }
 
-bool UUnusedMacroValidator::IsEnabled() const
+bool UUnusedMacroValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	static const UUnusedMacroValidator* CDO = GetDefault<UUnusedMacroValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && ValidatorX::GetAssetTagCount(InAssetData, ValidatorX::AssetTags::NumMacros) != 0;
 }
 
 EDataValidationResult UUnusedMacroValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if (UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
@@ -67,87 +60,48 @@ EDataValidationResult UUnusedMacroValidator::ValidateLoadedAsset_Implementation(
 
 			if(!bIsMacroUsed)
 			{
-				const FText MessageText = FText::Format(
-					INVTEXT("Macro '{0}' is never used."),
-					FText::FromName(MacroName)
-				);
-
-				TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-				Message->AddToken(FActionToken::Create(FText::FromString("Jump to macro"), FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
-						{
-							if(Blueprint && MacroGraph)
-							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-									if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-									{
-										if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-										{
-											BlueprintEditor->OpenGraphAndBringToFront(MacroGraph, true);
-											if(TSharedPtr<SMyBlueprint> MyBlueprintWidget = BlueprintEditor->GetMyBlueprintWidget())
-											{
-												MyBlueprintWidget->SelectItemByName(MacroGraph->GetFName(),
-													ESelectInfo::Direct,
-													INDEX_NONE,
-													false);
-											}
-										}
-									}
-								}
-							}
-						})
-				));
-
-				const FText DeleteMacroText = FText::Format(
-					INVTEXT("'Fix' - Delete Macro - '{0}'"),
-					FText::FromName(MacroName));
-
-				Message->AddToken(FActionToken::Create(DeleteMacroText, FText::GetEmpty(),
-					FSimpleDelegate::CreateLambda([=]
-						{
-							if(Blueprint && MacroGraph)
-							{
-								if(UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
-								{
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-
-									FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([=] (float DeltaTime)
-										{
-											if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-											{
-												if(FBlueprintEditor* BlueprintEditor = StaticCast<FBlueprintEditor*>(EditorInstance))
-												{
-													const FText ConfirmText = FText::Format(
-														INVTEXT("Are you sure you want to delete the unused Macro '{0}' from Blueprint '{1}'?"),
-														FText::FromName(MacroName),
-														FText::FromString(Blueprint->GetName())
-													);
-
-													if(FMessageDialog::Open(EAppMsgType::YesNo, ConfirmText) == EAppReturnType::Yes)
-													{
-														Blueprint->Modify();
-
-														Blueprint->MacroGraphs.Remove(MacroGraph);
-														MacroGraph->Modify();
-														MacroGraph->MarkAsGarbage();
-
-														FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-													}
-												}
-											}
-											return false;
-										}));
-								}
-							}
-						})));
-
-
-				bIsError = true;
+				ReportIssue(Context, MakeIssue(TEXT("UnusedMacro"), EMessageSeverity::Warning, Blueprint, NAME_None, MacroGraph));
 			}
 
 		}
 	}
 	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
+
+FText UUnusedMacroValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(
+		INVTEXT("Macro '{0}' is never used."),
+		Issue.GetGraphText()
+	);
+}
+
+void UUnusedMacroValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(ValidatorX::MakeJumpToIssueToken(Issue));
+
+	const FText DeleteMacroText = FText::Format(INVTEXT("'Fix' - Delete Macro - '{0}'"), Issue.GetGraphText());
+	const FText ConfirmText = FText::Format(
+		INVTEXT("Are you sure you want to delete the unused Macro '{0}' from Blueprint '{1}'?"),
+		Issue.GetGraphText(),
+		Issue.GetAssetText()
+	);
+
+	Message.AddToken(ValidatorX::MakeFixIssueToken(Issue, DeleteMacroText, ConfirmText, [GraphName = Issue.GraphName] (UBlueprint* Blueprint)
+		{
+			const TObjectPtr<UEdGraph>* Found = Blueprint->MacroGraphs.FindByPredicate([GraphName] (const UEdGraph* Graph) { return Graph && Graph->GetFName() == GraphName; });
+			if(!Found)
+			{
+				return;
+			}
+
+			UEdGraph* MacroGraph = *Found;
+			Blueprint->Modify();
+
+			Blueprint->MacroGraphs.Remove(MacroGraph);
+			MacroGraph->Modify();
+			MacroGraph->MarkAsGarbage();
+
+			FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+		}));
+}
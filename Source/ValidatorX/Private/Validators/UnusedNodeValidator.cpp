@@ -2,6 +2,7 @@
 
 
 #include "Validators/UnusedNodeValidator.h"
+#include "Analysis/BlueprintAssetTags.h"
 #include "Engine/Blueprint.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "EdGraph/EdGraph.h"
@@ -234,24 +235,19 @@ namespace ValidatorX
 	}
 };
 
-UUnusedNodeValidator::UUnusedNodeValidator()
-{
-	SetValidationEnabled(true);
-}
 bool UUnusedNodeValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) const
 {
-	return InAsset && InAsset->IsA<UBlueprint>();
+	return InAsset && InAsset->IsA<UBlueprint>() && PassesFailFast(Context);
 }
 
-bool UUnusedNodeValidator::IsEnabled() const
+bool UUnusedNodeValidator::CanValidateAssetData(const FAssetData& InAssetData) const
 {
-	static const UUnusedNodeValidator* CDO = GetDefault<UUnusedNodeValidator>();
-	return CDO->bIsEnabled && !bIsConfigDisabled;
+	return Super::CanValidateAssetData(InAssetData) && !ValidatorX::IsDataOnlyBlueprint(InAssetData);
 }
 
 EDataValidationResult UUnusedNodeValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
 {
-	bIsError = false;
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
 
 	if(UBlueprint* Blueprint = Cast<UBlueprint>(InAsset))
 	{
@@ -305,55 +301,7 @@ EDataValidationResult UUnusedNodeValidator::ValidateLoadedAsset_Implementation(c
 
 				if(bIsNodeUnused)
 				{
-					const FText MessageText = FText::Format(
-						INVTEXT("Node '{0}' in Graph '{1}' appears to be unused."),
-						FText::FromString(Node->GetNodeTitle(ENodeTitleType::FullTitle).ToString()),
-						FText::FromString(Graph->GetName())
-					);
-
-					TSharedRef<FTokenizedMessage> Message = Context.AddMessage(EMessageSeverity::Warning, MessageText);
-
-					Message->AddToken(FActionToken::Create(FText::FromString("Jump to graph"), FText::FromString(""),
-						FSimpleDelegate::CreateLambda([=]
-							{
-								if(Blueprint && Graph)
-								{
-									UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
-									AssetEditorSubsystem->OpenEditorForAsset(Blueprint);
-									if(IAssetEditorInstance* EditorInstance = AssetEditorSubsystem->FindEditorForAsset(Blueprint, false))
-									{
-										if(IBlueprintEditor* BlueprintEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
-										{
-											TSet<UObject*> NodesToSelect;
-											NodesToSelect.Add(Node);
-											if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Graph, true))
-											{
-												GraphEditor->JumpToNode(Node, false);
-
-
-												const bool bHasChain = ValidatorX::HasExecutionOutputConnections(Node);
-
-												FString Comment = bHasChain ? TEXT("Unused node chain") : TEXT("Unused node");
-												Node->NodeComment = Comment;
-												Node->bCommentBubbleVisible = true;
-
-												 // FVector2D Position(Node->NodePosX - 50, Node->NodePosY - 50);
-												 // FVector2D Size(Node->NodeWidth + 500, Node->NodeHeight + 500);
-												 // AddCommentNode(Graph, Position, Size, TEXT("Unused node detected"));
-
-												FNotificationInfo Info(FText::FromString(Comment));
-												Info.ExpireDuration = 3.0f;
-												Info.bUseThrobber = false;
-												Info.bUseSuccessFailIcons = false;
-												Info.bFireAndForget = true;
-												GraphEditor->AddNotification(Info, true);
-											}
-										}
-									}
-								}
-							})
-					));
-					bIsError = true;
+					ReportIssue(Context, MakeIssue(TEXT("UnusedNode"), EMessageSeverity::Warning, Blueprint, Node));
 				}
 			}
 		}
@@ -362,5 +310,43 @@ EDataValidationResult UUnusedNodeValidator::ValidateLoadedAsset_Implementation(c
 	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
 }
 
+FText UUnusedNodeValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	return FText::Format(
+		INVTEXT("Node '{0}' in Graph '{1}' appears to be unused."),
+		Issue.GetNodeTitle(ENodeTitleType::FullTitle),
+		Issue.GetGraphText()
+	);
+}
 
+void UUnusedNodeValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	Message.AddToken(FActionToken::Create(FText::FromString("Jump to graph"), FText::FromString(""),
+		FSimpleDelegate::CreateLambda([Issue]
+			{
+				ValidatorX::JumpToIssue(Issue);
 
+				UEdGraphNode* Node = Issue.FindNode();
+				UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
+				IAssetEditorInstance* EditorInstance = Node ? AssetEditorSubsystem->FindEditorForAsset(Issue.FindAsset(), false) : nullptr;
+				if(IBlueprintEditor* BlueprintEditor = StaticCast<IBlueprintEditor*>(EditorInstance))
+				{
+					if(TSharedPtr<SGraphEditor> GraphEditor = BlueprintEditor->OpenGraphAndBringToFront(Node->GetGraph(), true))
+					{
+						const bool bHasChain = ValidatorX::HasExecutionOutputConnections(Node);
+
+						FString Comment = bHasChain ? TEXT("Unused node chain") : TEXT("Unused node");
+						Node->NodeComment = Comment;
+						Node->bCommentBubbleVisible = true;
+
+						FNotificationInfo Info(FText::FromString(Comment));
+						Info.ExpireDuration = 3.0f;
+						Info.bUseThrobber = false;
+						Info.bUseSuccessFailIcons = false;
+						Info.bFireAndForget = true;
+						GraphEditor->AddNotification(Info, true);
+					}
+				}
+			})
+	));
+}
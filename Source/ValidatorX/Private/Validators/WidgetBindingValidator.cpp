@@ -0,0 +1,212 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Validators/WidgetBindingValidator.h"
+#include "Analysis/BlueprintCostModel.h"
+#include "Analysis/BlueprintExecFlow.h"
+#include "WidgetBlueprint.h"
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetTree.h"
+#include "K2Node_Event.h"
+#include "K2Node_FunctionEntry.h"
+#include "Misc/DataValidation.h"
+
+namespace ValidatorX
+{
+	UEdGraphNode* FindFunctionEntryNode(const UBlueprint* Blueprint, FName FunctionName)
+	{
+		for(UEdGraph* Graph : Blueprint->FunctionGraphs)
+		{
+			if(!Graph || Graph->GetFName() != FunctionName) continue;
+
+			for(UEdGraphNode* Node : Graph->Nodes)
+			{
+				if(Node && Node->IsA<UK2Node_FunctionEntry>())
+				{
+					return Node;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	int32 CountWidgetTreeBindings(const UWidgetBlueprint* WidgetBlueprint, TMap<const UWidgetBlueprint*, int32>& Memo)
+	{
+		if(const int32* Cached = Memo.Find(WidgetBlueprint))
+		{
+			return *Cached;
+		}
+
+		// Guards against widgets nesting themselves through their children
+		Memo.Add(WidgetBlueprint, 0);
+
+		int32 Total = WidgetBlueprint->Bindings.Num();
+		if(WidgetBlueprint->WidgetTree)
+		{
+			WidgetBlueprint->WidgetTree->ForEachWidget([&Total, &Memo] (UWidget* Widget)
+				{
+					if(const UUserWidget* UserWidget = Cast<UUserWidget>(Widget))
+					{
+						if(const UWidgetBlueprint* NestedBlueprint = Cast<UWidgetBlueprint>(UserWidget->GetClass()->ClassGeneratedBy))
+						{
+							Total += CountWidgetTreeBindings(NestedBlueprint, Memo);
+						}
+					}
+				});
+		}
+
+		Memo[WidgetBlueprint] = Total;
+		return Total;
+	}
+}
+
+bool UWidgetBindingValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const
+{
+	return InAsset && InAsset->IsA<UWidgetBlueprint>() && PassesFailFast(InContext);
+}
+
+bool UWidgetBindingValidator::CanValidateAssetData(const FAssetData& InAssetData) const
+{
+	return InAssetData.IsInstanceOf(UWidgetBlueprint::StaticClass());
+}
+
+EDataValidationResult UWidgetBindingValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+{
+	const FValidatorXValidationScope ValidationScope = BeginIssues(InAsset);
+
+	if(UWidgetBlueprint* WidgetBlueprint = Cast<UWidgetBlueprint>(InAsset))
+	{
+		// Per-frame work that must never create widgets or walk the widget tree
+		auto ReportPerFrameHazards = [&] (const TSet<UEdGraphNode*>& Nodes, FName BindingFunction)
+			{
+				for(UEdGraphNode* Node : Nodes)
+				{
+					const bool bCreatesObject = ValidatorX::IsObjectCreationNode(Node);
+					if(!bCreatesObject && !ValidatorX::IsWorldQueryNode(Node))
+					{
+						continue;
+					}
+
+					ReportIssue(Context, MakeIssue(TEXT("PerFrameHazard"), EMessageSeverity::Warning, WidgetBlueprint, Node)
+						.Add(bCreatesObject ? 1 : 0)
+						.Add(BindingFunction));
+				}
+			};
+
+		if(UK2Node_Event* TickEvent = ValidatorX::FindEventNode(WidgetBlueprint, FName(TEXT("Tick"))))
+		{
+			TSet<UEdGraphNode*> TickNodes;
+			UEdGraphNode* Roots[] = { TickEvent };
+			ValidatorX::CollectExecReachableNodes(WidgetBlueprint, Roots, TickNodes);
+			ReportPerFrameHazards(TickNodes, NAME_None);
+		}
+
+		// Bindings within budget are only counted in the tree total below, one record each would bury the actionable ones
+		for(const FDelegateEditorBinding& Binding : WidgetBlueprint->Bindings)
+		{
+			if(Binding.Kind == EBindingKind::Property)
+			{
+				continue;
+			}
+
+			UEdGraphNode* EntryNode = ValidatorX::FindFunctionEntryNode(WidgetBlueprint, Binding.FunctionName);
+			if(!EntryNode)
+			{
+				continue;
+			}
+
+			TSet<UEdGraphNode*> BindingNodes;
+			UEdGraphNode* Roots[] = { EntryNode };
+			ValidatorX::CollectExecReachableNodes(WidgetBlueprint, Roots, BindingNodes);
+
+			const int32 BindingCost = ValidatorX::EstimateNodesCost(BindingNodes);
+			if(BindingCost > BindingCostBudget)
+			{
+				const FString BindingName = FString::Printf(TEXT("%s.%s"), *Binding.ObjectName, *Binding.PropertyName.ToString());
+				ReportIssue(Context, MakeIssue(TEXT("Binding"), EMessageSeverity::Warning, WidgetBlueprint, FName(*BindingName))
+					.Add(Binding.FunctionName)
+					.Add(BindingCost)
+					.Add(BindingCostBudget));
+			}
+
+			ReportPerFrameHazards(BindingNodes, Binding.FunctionName);
+		}
+
+		TMap<const UWidgetBlueprint*, int32> BindingCountMemo;
+		const int32 TreeBindings = ValidatorX::CountWidgetTreeBindings(WidgetBlueprint, BindingCountMemo);
+		if(TreeBindings > 0)
+		{
+			const bool bTooMany = TreeBindings > MaxBindingsPerTree;
+			ReportIssue(Context, MakeIssue(TEXT("TreeBindings"), bTooMany ? EMessageSeverity::Warning : EMessageSeverity::Info, WidgetBlueprint)
+				.Add(TreeBindings)
+				.Add(WidgetBlueprint->Bindings.Num())
+				.Add(TreeBindings - WidgetBlueprint->Bindings.Num())
+				.Add(MaxBindingsPerTree));
+		}
+	}
+
+	return bIsError ? EDataValidationResult::Invalid : EDataValidationResult::Valid;
+}
+
+FText UWidgetBindingValidator::FormatIssue(const FValidatorXIssue& Issue) const
+{
+	if(Issue.RuleId == TEXT("PerFrameHazard"))
+	{
+		const FName BindingFunction = Issue.Args.IsValidIndex(1) ? Issue.Args[1].Value.Get<FName>() : NAME_None;
+		return FText::Format(
+			INVTEXT("'{0}' runs every frame in {1} of Widget Blueprint '{2}'. {3}"),
+			Issue.GetNodeTitle(),
+			BindingFunction.IsNone() ? INVTEXT("Tick") : FText::Format(INVTEXT("binding function '{0}'"), FText::FromName(BindingFunction)),
+			Issue.GetAssetText(),
+			Issue.GetNumberArg(0) != 0
+				? INVTEXT("Create widgets once and show/hide or pool them instead.")
+				: INVTEXT("Cache the result when the widget is constructed instead of querying every frame.")
+		);
+	}
+
+	if(Issue.RuleId == TEXT("TreeBindings"))
+	{
+		return FText::Format(
+			INVTEXT("Widget tree of '{0}' evaluates {1} property bindings per frame ({2} own, {3} from nested user widgets, limit {4})."),
+			Issue.GetAssetText(),
+			Issue.GetArg(0),
+			Issue.GetArg(1),
+			Issue.GetArg(2),
+			Issue.GetArg(3)
+		);
+	}
+
+	return FText::Format(
+		INVTEXT("Binding '{0}' calls function '{1}' every frame (estimated cost {2}, budget {3}). Update the widget from an event when the value changes instead."),
+		Issue.GetMemberText(),
+		Issue.GetArg(0),
+		Issue.GetArg(1),
+		Issue.GetArg(2)
+	);
+}
+
+void UWidgetBindingValidator::AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const
+{
+	if(Issue.RuleId == TEXT("PerFrameHazard"))
+	{
+		Super::AddIssueTokens(Issue, Message);
+		return;
+	}
+
+	if(Issue.RuleId != TEXT("Binding"))
+	{
+		return;
+	}
+
+	// Binding records are keyed by the bound property; jump to the function graph
+	FValidatorXIssue Function = Issue;
+	Function.MemberName = NAME_None;
+	Function.GraphName = Issue.Args[0].Value.Get<FName>();
+
+	Message.AddToken(FActionToken::Create(FText::FromString("Jump to function"), FText::GetEmpty(),
+		FSimpleDelegate::CreateLambda([Function]
+			{
+				ValidatorX::JumpToIssue(Function);
+			})
+	));
+}
@@ -3,6 +3,16 @@
 
 #include "Widgets/SValidatorWidget.h"
 #include "BaseClasses/BlueprintValidatorBase.h"
+#include "ValidatorXConfigManager.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Misc/Paths.h"
+#include "Reporting/ReportWriter.h"
+#include "Widgets/SValidatorXDashboard.h"
+#include "Widgets/SValidatorXIssueBrowser.h"
+#include "Widgets/SValidatorXSchedule.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Notifications/SNotificationList.h"
 #include "Styling/SlateStyleRegistry.h"
 
 namespace ValidatorListColumns
@@ -116,25 +126,7 @@ public:
 							{
 								if(Validator.IsValid())
 								{
-									switch(NewState)
-									{
-									case ECheckBoxState::Unchecked:
-										Validator->SetValidationEnabled(false);
-										UE_LOG(LogTemp, Warning, TEXT("Validator %s Disabled (IsEnabled: %s)"),
-										*Validator->GetName(),
-										Validator->IsEnabled() ? TEXT("true") : TEXT("false"));
-										break;
-
-									case ECheckBoxState::Checked:
-										Validator->SetValidationEnabled(true);
-										UE_LOG(LogTemp, Warning, TEXT("Validator %s Enabled (IsEnabled: %s)"),
-										*Validator->GetName(), 
-										Validator->IsEnabled() ? TEXT("true") : TEXT("false"));
-										break;
-
-									default:
-										break;
-									}
+									Validator->SetValidationEnabled(NewState == ECheckBoxState::Checked);
 								}
 							})
 				];
@@ -192,56 +184,154 @@ void SValidatorWidget::Construct(const FArguments& InArgs)
 				.AreaTitleFont(FontInfo)
 				.BodyContent()
 				[
-					SAssignNew(ListViewWidget, SListView<TWeakObjectPtr<UBlueprintValidatorBase>>)
-						.ListItemsSource(&LocalValidators)
-						.OnGenerateRow(this, &SValidatorWidget::OnGenerateRowForList)
-						.SelectionMode(ESelectionMode::None)
-						.HeaderRow
-						(
-							SNew(SHeaderRow)
-							+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Type)
-							.FillWidth(0.4f)
-							.FixedWidth(StaticCast<TOptional<float>>(200.0f))
-							[
-								SNew(STextBlock).Text(FText::FromString("Type")).Justification(ETextJustify::Center).Font(FontInfo)
-							]
-
-							+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Name)
-							.FillWidth(0.4f)
-							[
-								SNew(STextBlock).Text(FText::FromString("Validator Name")).Justification(ETextJustify::Center).Font(FontInfo)
-							]
-
-							+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Button)
-							.FixedWidth(StaticCast<TOptional<float>>(50.0f))
-							[
-								SNew(SBox)
-									.VAlign(VAlign_Center)
-									.HAlign(HAlign_Center)
-									[
-										SNew(SCheckBox)
-											.HAlign(HAlign_Center)
-											.ToolTipText(FText::FromString("Enable/Disable all validators"))
-											.OnCheckStateChanged_Lambda([this] (ECheckBoxState NewState)
-												{
-													const bool bEnableAll = (NewState == ECheckBoxState::Checked);
-													for(const TWeakObjectPtr<UBlueprintValidatorBase>& Validator : LocalValidators)
+					SNew(SVerticalBox)
+					+ SVerticalBox::Slot()
+					.AutoHeight()
+					.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+					[
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						.VAlign(VAlign_Center)
+						.Padding(0.0f, 0.0f, 8.0f, 0.0f)
+						[
+							SNew(STextBlock).Text(FText::FromString("Preset"))
+						]
+						+ SHorizontalBox::Slot()
+						.AutoWidth()
+						[
+							SNew(SComboButton)
+								.ToolTipText(FText::FromString("Enables the validators of a preset with a single config write"))
+								.ButtonContent()
+								[
+									SNew(STextBlock).Text(this, &SValidatorWidget::GetPresetText)
+								]
+								.OnGetMenuContent(this, &SValidatorWidget::MakePresetMenu)
+						]
+					]
+					+ SVerticalBox::Slot()
+					[
+						SAssignNew(ListViewWidget, SListView<TWeakObjectPtr<UBlueprintValidatorBase>>)
+							.ListItemsSource(&LocalValidators)
+							.OnGenerateRow(this, &SValidatorWidget::OnGenerateRowForList)
+							.SelectionMode(ESelectionMode::None)
+							.HeaderRow
+							(
+								SNew(SHeaderRow)
+								+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Type)
+								.FillWidth(0.4f)
+								.FixedWidth(StaticCast<TOptional<float>>(200.0f))
+								[
+									SNew(STextBlock).Text(FText::FromString("Type")).Justification(ETextJustify::Center).Font(FontInfo)
+								]
+
+								+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Name)
+								.FillWidth(0.4f)
+								[
+									SNew(STextBlock).Text(FText::FromString("Validator Name")).Justification(ETextJustify::Center).Font(FontInfo)
+								]
+
+								+ SHeaderRow::Column(ValidatorListColumns::ColumnID_Button)
+								.FixedWidth(StaticCast<TOptional<float>>(50.0f))
+								[
+									SNew(SBox)
+										.VAlign(VAlign_Center)
+										.HAlign(HAlign_Center)
+										[
+											SNew(SCheckBox)
+												.HAlign(HAlign_Center)
+												.ToolTipText(FText::FromString("Enable/Disable all validators"))
+												.IsChecked(this, &SValidatorWidget::GetAllEnabledState)
+												.OnCheckStateChanged_Lambda([this] (ECheckBoxState NewState)
 													{
-														if(Validator.IsValid())
+														// One config write for all of them
+														FValidatorXConfigManager::Get().SetAllEnabled(NewState == ECheckBoxState::Checked);
+														if(ListViewWidget.IsValid())
 														{
-															Validator->SetValidationEnabled(bEnableAll);
+															ListViewWidget->RequestListRefresh();
 														}
-													}
-													if(ListViewWidget.IsValid())
-													{
-														ListViewWidget->RequestListRefresh();
-													}
-												})
+													})
+
+										]
+								]
+							)
+					]
+				]
+		]
+
+		+ SVerticalBox::Slot()
+		.Padding(4)
+		[
+			SNew(SExpandableArea)
+				.InitiallyCollapsed(true)
+				.AreaTitle(FText::FromString("Project Health"))
+				.AreaTitleFont(FontInfo)
+				.BodyContent()
+				[
+					SNew(SBox)
+						.MinDesiredHeight(400.0f)
+						[
+							SNew(SValidatorXDashboard)
+						]
+				]
+		]
 
-									]
-							]
-						)
+		+ SVerticalBox::Slot()
+		.Padding(4)
+		[
+			SNew(SExpandableArea)
+				.InitiallyCollapsed(true)
+				.AreaTitle(FText::FromString("Issues"))
+				.AreaTitleFont(FontInfo)
+				.BodyContent()
+				[
+					SNew(SBox)
+						.MinDesiredHeight(400.0f)
+						[
+							SNew(SValidatorXIssueBrowser)
+						]
 				]
+		]
+
+		+ SVerticalBox::Slot()
+		.Padding(4)
+		[
+			SNew(SExpandableArea)
+				.InitiallyCollapsed(true)
+				.AreaTitle(FText::FromString("Validator Schedule"))
+				.AreaTitleFont(FontInfo)
+				.BodyContent()
+				[
+					SNew(SBox)
+						.MinDesiredHeight(300.0f)
+						[
+							SNew(SValidatorXSchedule)
+						]
+				]
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Export SARIF"))
+					.ToolTipText(FText::FromString("Writes the issues of the latest validations to Saved/ValidatorX/ValidatorX.sarif"))
+					.OnClicked(this, &SValidatorWidget::OnExportReport, FString(TEXT("ValidatorX.sarif")))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Export JSON Lines"))
+					.ToolTipText(FText::FromString("Writes the issues of the latest validations to Saved/ValidatorX/ValidatorX.jsonl"))
+					.OnClicked(this, &SValidatorWidget::OnExportReport, FString(TEXT("ValidatorX.jsonl")))
+			]
 		];
 
 	ChildSlot
@@ -255,4 +345,62 @@ TSharedRef<ITableRow> SValidatorWidget::OnGenerateRowForList(TWeakObjectPtr<UBlu
 	return SNew(SValidatorTableRow, OwnerTable)
 		.Validator(InItem)
 		.Font(FontInfo);
-}
\ No newline at end of file
+}
+
+FReply SValidatorWidget::OnExportReport(FString FileName)
+{
+	const FString ReportPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("ValidatorX") / FileName);
+	const bool bWritten = FValidatorXReportWriter::WriteIssueLog(ReportPath);
+
+	FNotificationInfo Info(FText::Format(bWritten ? INVTEXT("Report written to {0}") : INVTEXT("Could not write {0}"), FText::FromString(ReportPath)));
+	Info.ExpireDuration = 5.0f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+	return FReply::Handled();
+}
+
+ECheckBoxState SValidatorWidget::GetAllEnabledState() const
+{
+	int32 NumEnabled = 0;
+	int32 NumValidators = 0;
+	for(const TWeakObjectPtr<UBlueprintValidatorBase>& Validator : LocalValidators)
+	{
+		if(Validator.IsValid() && !Validator->IsConfigDisabled())
+		{
+			NumEnabled += Validator->IsEnabled() ? 1 : 0;
+			NumValidators++;
+		}
+	}
+
+	if(NumEnabled == 0)
+	{
+		return ECheckBoxState::Unchecked;
+	}
+	return NumEnabled == NumValidators ? ECheckBoxState::Checked : ECheckBoxState::Undetermined;
+}
+
+FText SValidatorWidget::GetPresetText() const
+{
+	const FValidatorXPreset* Preset = FValidatorXConfigManager::Get().GetActivePreset();
+	return Preset ? Preset->DisplayName : FText::FromString("Custom");
+}
+
+TSharedRef<SWidget> SValidatorWidget::MakePresetMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+	for(const FValidatorXPreset& Preset : FValidatorXConfigManager::Get().GetPresets())
+	{
+		MenuBuilder.AddMenuEntry(
+			Preset.DisplayName,
+			Preset.Description,
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([this, Name = Preset.Name]
+				{
+					FValidatorXConfigManager::Get().ApplyPreset(Name);
+					if(ListViewWidget.IsValid())
+					{
+						ListViewWidget->RequestListRefresh();
+					}
+				})));
+	}
+	return MenuBuilder.MakeWidget();
+}
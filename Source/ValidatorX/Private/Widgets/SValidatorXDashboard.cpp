@@ -0,0 +1,429 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/SValidatorXDashboard.h"
+#include "Editor.h"
+#include "Reporting/IssueLog.h"
+#include "ValidatorXBackgroundScan.h"
+#include "Subsystems/AssetEditorSubsystem.h"
+#include "UObject/SoftObjectPath.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Input/SSegmentedControl.h"
+#include "Widgets/Text/STextBlock.h"
+
+namespace DashboardColumns
+{
+	static const FName ColumnIds[] =
+	{
+		"Name", "Folder", "Nodes", "Graphs", "MaxGraphNodes", "MacroInstances", "TickingEvents", "TickCost", "HardReferences", "Issues"
+	};
+	static_assert(UE_ARRAY_COUNT(ColumnIds) == static_cast<int32>(EValidatorXHealthColumn::Num), "One id per health column");
+
+	static EValidatorXHealthColumn FindColumn(FName ColumnId)
+	{
+		for(int32 Index = 0; Index < UE_ARRAY_COUNT(ColumnIds); ++Index)
+		{
+			if(ColumnIds[Index] == ColumnId)
+			{
+				return static_cast<EValidatorXHealthColumn>(Index);
+			}
+		}
+		return EValidatorXHealthColumn::Num;
+	}
+}
+
+class SValidatorXDashboardRow : public SMultiColumnTableRow<TSharedPtr<FValidatorXDashboardItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXDashboardRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FValidatorXDashboardItem>, Item)
+		SLATE_ARGUMENT(const SValidatorXDashboard*, Dashboard)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		Item = InArgs._Item;
+		Dashboard = InArgs._Dashboard;
+
+		SMultiColumnTableRow::Construct(FSuperRowType::FArguments()
+			.Style(FAppStyle::Get(), "ContentBrowser.AssetListView.ColumnListTableRow"), InOwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		const EValidatorXHealthColumn Column = DashboardColumns::FindColumn(ColumnId);
+		if(Column == EValidatorXHealthColumn::Num)
+		{
+			return SNullWidget::NullWidget;
+		}
+
+		const bool bIsText = Column == EValidatorXHealthColumn::Name || Column == EValidatorXHealthColumn::Folder;
+		return SNew(SBox)
+			.Padding(4.0f, 2.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+					.Text(Dashboard->GetCellText(*Item, Column))
+					.Justification(bIsText ? ETextJustify::Left : ETextJustify::Right)
+			];
+	}
+
+private:
+	TSharedPtr<FValidatorXDashboardItem> Item;
+	const SValidatorXDashboard* Dashboard = nullptr;
+};
+
+void SValidatorXDashboard::Construct(const FArguments& InArgs)
+{
+	TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow);
+	for(int32 Index = 0; Index < static_cast<int32>(EValidatorXHealthColumn::Num); ++Index)
+	{
+		const EValidatorXHealthColumn Column = static_cast<EValidatorXHealthColumn>(Index);
+		SHeaderRow::FColumn::FArguments ColumnArgs = SHeaderRow::Column(DashboardColumns::ColumnIds[Index])
+			.DefaultLabel(FValidatorXHealthTable::GetColumnLabel(Column))
+			.SortMode(this, &SValidatorXDashboard::GetColumnSortMode, DashboardColumns::ColumnIds[Index])
+			.OnSort(this, &SValidatorXDashboard::OnSortModeChanged);
+
+		if(Column == EValidatorXHealthColumn::Name || Column == EValidatorXHealthColumn::Folder)
+		{
+			ColumnArgs.FillWidth(Column == EValidatorXHealthColumn::Name ? 0.25f : 0.2f);
+		}
+		else
+		{
+			ColumnArgs.FillWidth(0.07f).HAlignCell(HAlign_Right);
+		}
+		HeaderRow->AddColumn(ColumnArgs);
+	}
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SAssignNew(SearchBox, SSearchBox)
+					.HintText(FText::FromString("Filter by path"))
+					.OnTextChanged(this, &SValidatorXDashboard::OnFilterTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SSegmentedControl<EGroupMode>)
+					.Value_Lambda([this] { return GroupMode; })
+					.OnValueChanged(this, &SValidatorXDashboard::OnGroupModeChanged)
+					+ SSegmentedControl<EGroupMode>::Slot(EGroupMode::None).Text(FText::FromString("Assets"))
+					+ SSegmentedControl<EGroupMode>::Slot(EGroupMode::Folder).Text(FText::FromString("Folders"))
+					+ SSegmentedControl<EGroupMode>::Slot(EGroupMode::Validator).Text(FText::FromString("Validators"))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Clear Validator Filter"))
+					.Visibility_Lambda([this] { return ValidatorFilter != INDEX_NONE ? EVisibility::Visible : EVisibility::Collapsed; })
+					.OnClicked_Lambda([this]
+						{
+							ValidatorFilter = INDEX_NONE;
+							Refresh();
+							return FReply::Handled();
+						})
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SButton)
+					.Text_Lambda([] { return FValidatorXBackgroundScan::Get().IsRunning() ? FText::FromString("Stop Scan") : FText::FromString("Scan Project"); })
+					.ToolTipText(FText::FromString("Validates every Blueprint under /Game in the background while the editor is idle"))
+					.OnClicked(this, &SValidatorXDashboard::OnToggleScan)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Refresh"))
+					.ToolTipText(FText::FromString("Reads the Blueprint metrics from the asset registry and the issue counts of the latest validations"))
+					.OnClicked(this, &SValidatorXDashboard::OnRebuild)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FValidatorXDashboardItem>>)
+				.ListItemsSource(&VisibleItems)
+				.OnGenerateRow(this, &SValidatorXDashboard::OnGenerateRow)
+				.OnMouseButtonDoubleClick(this, &SValidatorXDashboard::OnItemDoubleClicked)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow(HeaderRow)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 4.0f, 0.0f, 0.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(STextBlock)
+					.Text(this, &SValidatorXDashboard::GetSummaryText)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(STextBlock)
+					.Text_Lambda([] { return FValidatorXBackgroundScan::Get().GetStatusText(); })
+			]
+		]
+	];
+
+	FValidatorXBackgroundScan::Get().OnProgress().AddSP(this, &SValidatorXDashboard::OnScanProgress);
+	OnRebuild();
+}
+
+FReply SValidatorXDashboard::OnRebuild()
+{
+	Table.Build(TEXT("/Game"));
+	Refresh();
+	if(ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+	return FReply::Handled();
+}
+
+void SValidatorXDashboard::OnScanProgress()
+{
+	Table.UpdateIssues();
+	Refresh();
+	if(ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+}
+
+FReply SValidatorXDashboard::OnToggleScan()
+{
+	FValidatorXBackgroundScan& Scan = FValidatorXBackgroundScan::Get();
+	if(Scan.IsRunning())
+	{
+		Scan.Stop();
+	}
+	else
+	{
+		Scan.Start();
+	}
+	return FReply::Handled();
+}
+
+void SValidatorXDashboard::Refresh(bool bNarrow)
+{
+	Groups.Reset();
+	if(bNarrow)
+	{
+		const TArray<int32> PreviousRows = MoveTemp(Rows);
+		Table.Query(FilterText, ValidatorFilter, &PreviousRows, Rows);
+	}
+	else
+	{
+		Table.Query(FilterText, ValidatorFilter, nullptr, Rows);
+		Table.SortRows(Rows, SortColumn, SortMode == EColumnSortMode::Descending);
+	}
+
+	if(GroupMode == EGroupMode::Folder)
+	{
+		Table.GroupByFolder(Rows, Groups);
+	}
+	else if(GroupMode == EGroupMode::Validator)
+	{
+		Table.GroupByValidator(Rows, Groups);
+	}
+	FValidatorXHealthTable::SortGroups(Groups, SortColumn, SortMode == EColumnSortMode::Descending);
+
+	// Items are only created the first time an index is needed, refreshing just copies pointers
+	for(int32 Index = ItemPool.Num(); Index < FMath::Max(Table.Num(), Groups.Num()); ++Index)
+	{
+		ItemPool.Add(MakeShared<FValidatorXDashboardItem>(FValidatorXDashboardItem{ Index }));
+	}
+
+	VisibleItems.Reset();
+	if(GroupMode == EGroupMode::None)
+	{
+		for(const int32 Row : Rows)
+		{
+			VisibleItems.Add(ItemPool[Row]);
+		}
+	}
+	else
+	{
+		for(int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+		{
+			VisibleItems.Add(ItemPool[GroupIndex]);
+		}
+	}
+
+	// Group items are reused for other groups and rows show static text, so those need new row widgets
+	if(ListView.IsValid())
+	{
+		if(GroupMode != EGroupMode::None || GroupMode != DisplayedGroupMode)
+		{
+			ListView->RebuildList();
+		}
+		else
+		{
+			ListView->RequestListRefresh();
+		}
+	}
+	DisplayedGroupMode = GroupMode;
+}
+
+FText SValidatorXDashboard::GetCellText(const FValidatorXDashboardItem& Item, EValidatorXHealthColumn Column) const
+{
+	if(GroupMode != EGroupMode::None)
+	{
+		if(!Groups.IsValidIndex(Item.Index))
+		{
+			return FText::GetEmpty();
+		}
+
+		const FValidatorXHealthTable::FGroup& Group = Groups[Item.Index];
+		switch(Column)
+		{
+		case EValidatorXHealthColumn::Name:   return FText::FromName(Group.Key);
+		case EValidatorXHealthColumn::Folder: return FText::Format(INVTEXT("{0} assets"), FText::AsNumber(Group.NumAssets));
+		default:                              return FText::AsNumber(Group.Values[static_cast<int32>(Column) - FValidatorXHealthTable::FirstMetric]);
+		}
+	}
+
+	switch(Column)
+	{
+	case EValidatorXHealthColumn::Name:   return FText::FromName(Table.GetAssetName(Item.Index));
+	case EValidatorXHealthColumn::Folder: return FText::FromName(Table.GetFolder(Item.Index));
+	default:
+		{
+			// Saved before ValidatorX wrote its tags
+			const int32 Value = Table.GetValue(Item.Index, Column);
+			return Value == INDEX_NONE ? INVTEXT("-") : FText::AsNumber(Value);
+		}
+	}
+}
+
+void SValidatorXDashboard::OnFilterTextChanged(const FText& Text)
+{
+	const FString NewFilterText = Text.ToString();
+	const bool bNarrow = !FilterText.IsEmpty() && NewFilterText.Contains(FilterText);
+	FilterText = NewFilterText;
+	Refresh(bNarrow);
+}
+
+void SValidatorXDashboard::OnGroupModeChanged(EGroupMode NewMode)
+{
+	GroupMode = NewMode;
+	Refresh();
+}
+
+void SValidatorXDashboard::OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode)
+{
+	SortColumn = DashboardColumns::FindColumn(ColumnId);
+	SortMode = NewSortMode;
+	Refresh();
+}
+
+EColumnSortMode::Type SValidatorXDashboard::GetColumnSortMode(FName ColumnId) const
+{
+	return DashboardColumns::FindColumn(ColumnId) == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SValidatorXDashboard::OnItemDoubleClicked(TSharedPtr<FValidatorXDashboardItem> Item)
+{
+	if(!Item.IsValid())
+	{
+		return;
+	}
+
+	if(GroupMode == EGroupMode::None)
+	{
+		OpenRow(Item->Index);
+		return;
+	}
+
+	if(!Groups.IsValidIndex(Item->Index))
+	{
+		return;
+	}
+
+	const FName Key = Groups[Item->Index].Key;
+	if(GroupMode == EGroupMode::Folder)
+	{
+		FilterText = Key.ToString() + TEXT("/");
+		SearchBox->SetText(FText::FromString(FilterText));
+	}
+	else
+	{
+		ValidatorFilter = Table.GetValidatorIndex(Key);
+	}
+	GroupMode = EGroupMode::None;
+	Refresh();
+}
+
+void SValidatorXDashboard::OpenRow(int32 Row) const
+{
+	const FName PackageName = Table.GetPackageName(Row);
+	const FName ValidatorName = Table.GetValidatorNames().IsValidIndex(ValidatorFilter) ? Table.GetValidatorNames()[ValidatorFilter] : NAME_None;
+
+	// Prefer an issue of the filtered validator, then any issue of the asset
+	const FValidatorXIssueTable& IssueTable = FValidatorXIssueLog::Get().GetTable();
+	int32 TargetRow = INDEX_NONE;
+	bool bTargetMatchesValidator = false;
+	IssueTable.ForEachPackageRow(PackageName, [&] (int32 IssueRow)
+		{
+			const UClass* Validator = IssueTable.GetValidator(IssueRow);
+			const bool bMatchesValidator = ValidatorName != NAME_None && Validator && Validator->GetFName() == ValidatorName;
+			if(TargetRow == INDEX_NONE || (bMatchesValidator && !bTargetMatchesValidator))
+			{
+				TargetRow = IssueRow;
+				bTargetMatchesValidator = bMatchesValidator;
+			}
+		});
+
+	if(TargetRow != INDEX_NONE)
+	{
+		ValidatorX::JumpToIssue(IssueTable.GetIssue(TargetRow));
+		return;
+	}
+
+	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
+	if(UObject* Asset = FSoftObjectPath(FString::Printf(TEXT("%s.%s"), *PackageName.ToString(), *Table.GetAssetName(Row).ToString())).TryLoad())
+	{
+		if(AssetEditorSubsystem)
+		{
+			AssetEditorSubsystem->OpenEditorForAsset(Asset);
+		}
+	}
+}
+
+TSharedRef<ITableRow> SValidatorXDashboard::OnGenerateRow(TSharedPtr<FValidatorXDashboardItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SValidatorXDashboardRow, OwnerTable)
+		.Item(Item)
+		.Dashboard(this);
+}
+
+FText SValidatorXDashboard::GetSummaryText() const
+{
+	if(GroupMode == EGroupMode::None)
+	{
+		return FText::Format(INVTEXT("{0} of {1} Blueprints, {2} ticking"), FText::AsNumber(Rows.Num()), FText::AsNumber(Table.Num()), FText::AsNumber(Table.NumTicking()));
+	}
+	return FText::Format(INVTEXT("{0} groups over {1} of {2} Blueprints, {3} ticking"), FText::AsNumber(Groups.Num()), FText::AsNumber(Rows.Num()), FText::AsNumber(Table.Num()), FText::AsNumber(Table.NumTicking()));
+}
@@ -0,0 +1,361 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/SValidatorXIssueBrowser.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+namespace IssueBrowserColumns
+{
+	static const FName ColumnID_Severity("Severity");
+	static const FName ColumnID_Validator("Validator");
+	static const FName ColumnID_Rule("Rule");
+	static const FName ColumnID_Asset("Asset");
+	static const FName ColumnID_Location("Location");
+	static const FName ColumnID_Message("Message");
+}
+
+class SValidatorXIssueBrowserRow : public SMultiColumnTableRow<TSharedPtr<FValidatorXIssueBrowserItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXIssueBrowserRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FValidatorXIssueBrowserItem>, Item)
+		SLATE_ARGUMENT(const SValidatorXIssueBrowser*, Browser)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		Item = InArgs._Item;
+		Browser = InArgs._Browser;
+
+		SMultiColumnTableRow::Construct(FSuperRowType::FArguments()
+			.Style(FAppStyle::Get(), "ContentBrowser.AssetListView.ColumnListTableRow"), InOwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		// Only called for rows on screen, so messages are formatted for those alone
+		const FText Text = Browser->GetCellText(Item->Row, ColumnId);
+		return SNew(SBox)
+			.Padding(4.0f, 2.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+					.Text(Text)
+					.ToolTipText(ColumnId == IssueBrowserColumns::ColumnID_Message ? Text : FText::GetEmpty())
+			];
+	}
+
+private:
+	TSharedPtr<FValidatorXIssueBrowserItem> Item;
+	const SValidatorXIssueBrowser* Browser = nullptr;
+};
+
+void SValidatorXIssueBrowser::Construct(const FArguments& InArgs)
+{
+	auto MakeSeverityToggle = [this] (EMessageSeverity::Type Severity)
+		{
+			return SNew(SCheckBox)
+				.Style(FAppStyle::Get(), "ToggleButtonCheckbox")
+				.IsChecked(this, &SValidatorXIssueBrowser::GetSeverityState, Severity)
+				.OnCheckStateChanged(this, &SValidatorXIssueBrowser::OnSeverityStateChanged, Severity)
+				[
+					SNew(STextBlock)
+						.Margin(FMargin(6.0f, 2.0f))
+						.Text(this, &SValidatorXIssueBrowser::GetSeverityLabel, Severity)
+				];
+		};
+
+	auto MakeFacetButton = [this] (const TCHAR* Label, bool bValidators)
+		{
+			return SNew(SComboButton)
+				.ButtonContent()
+				[
+					SNew(STextBlock).Text(FText::FromString(Label))
+				]
+				.OnGetMenuContent(this, &SValidatorXIssueBrowser::MakeFacetMenu, bValidators);
+		};
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.Padding(0.0f, 0.0f, 4.0f, 0.0f)
+			[
+				SNew(SSearchBox)
+					.HintText(FText::FromString("Search assets, graphs, members and rules"))
+					.OnTextChanged(this, &SValidatorXIssueBrowser::OnSearchTextChanged)
+			]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(0.0f, 0.0f, 4.0f, 0.0f)[ MakeSeverityToggle(EMessageSeverity::Error) ]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(0.0f, 0.0f, 4.0f, 0.0f)[ MakeSeverityToggle(EMessageSeverity::Warning) ]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(0.0f, 0.0f, 4.0f, 0.0f)[ MakeSeverityToggle(EMessageSeverity::Info) ]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(0.0f, 0.0f, 4.0f, 0.0f)[ MakeFacetButton(TEXT("Validators"), true) ]
+			+ SHorizontalBox::Slot().AutoWidth().Padding(0.0f, 0.0f, 4.0f, 0.0f)[ MakeFacetButton(TEXT("Folders"), false) ]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Refresh"))
+					.ToolTipText(FText::FromString("Takes the issues of the latest validations"))
+					.OnClicked(this, &SValidatorXIssueBrowser::OnRebuild)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FValidatorXIssueBrowserItem>>)
+				.ListItemsSource(&VisibleItems)
+				.OnGenerateRow(this, &SValidatorXIssueBrowser::OnGenerateRow)
+				.OnMouseButtonDoubleClick(this, &SValidatorXIssueBrowser::OnItemDoubleClicked)
+				.SelectionMode(ESelectionMode::Single)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Severity).DefaultLabel(FText::FromString("Severity")).FixedWidth(80.0f)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Validator).DefaultLabel(FText::FromString("Validator")).FillWidth(0.15f)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Rule).DefaultLabel(FText::FromString("Rule")).FillWidth(0.1f)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Asset).DefaultLabel(FText::FromString("Asset")).FillWidth(0.15f)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Location).DefaultLabel(FText::FromString("Location")).FillWidth(0.15f)
+					+ SHeaderRow::Column(IssueBrowserColumns::ColumnID_Message).DefaultLabel(FText::FromString("Message")).FillWidth(0.45f)
+				)
+		]
+
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 4.0f, 0.0f, 0.0f)
+		[
+			SNew(STextBlock)
+				.Text(this, &SValidatorXIssueBrowser::GetSummaryText)
+		]
+	];
+
+	OnRebuild();
+}
+
+void SValidatorXIssueBrowser::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// The table was compacted or reset, the listed row indices now point at other issues
+	if(Table.GetLayoutVersion() != LayoutVersion)
+	{
+		OnRebuild();
+	}
+}
+
+FReply SValidatorXIssueBrowser::OnRebuild()
+{
+	LayoutVersion = Table.GetLayoutVersion();
+	Facets = Table.MakeAllFacets();
+	ItemPool.SetNum(FMath::Min(ItemPool.Num(), Table.NumRows()));
+
+	Refresh();
+	if(ListView.IsValid())
+	{
+		// Same items, different issues behind them
+		ListView->RebuildList();
+	}
+	return FReply::Handled();
+}
+
+void SValidatorXIssueBrowser::SyncWithTable()
+{
+	const int32 NumItems = ItemPool.Num();
+	ItemPool.SetNum(Table.NumRows());
+	for(int32 Row = NumItems; Row < ItemPool.Num(); ++Row)
+	{
+		ItemPool[Row] = MakeShared<FValidatorXIssueBrowserItem>(FValidatorXIssueBrowserItem{ Row });
+	}
+
+	Facets.Validators.Add(true, Table.GetValidatorClasses().Num() - Facets.Validators.Num());
+	Facets.Folders.Add(true, Table.GetFolders().Num() - Facets.Folders.Num());
+}
+
+void SValidatorXIssueBrowser::Refresh(bool bNarrow)
+{
+	SyncWithTable();
+	if(bNarrow)
+	{
+		const TArray<int32> PreviousRows = MoveTemp(SearchRows);
+		Table.Search(SearchText, &PreviousRows, SearchRows);
+	}
+	else
+	{
+		Table.Search(SearchText, nullptr, SearchRows);
+	}
+
+	Table.CountFacets(SearchRows, SeverityCounts, ValidatorCounts, FolderCounts);
+	RefreshFacets();
+}
+
+void SValidatorXIssueBrowser::RefreshFacets()
+{
+	Table.ApplyFacets(SearchRows, Facets, Rows);
+
+	VisibleItems.Reset(Rows.Num());
+	for(const int32 Row : Rows)
+	{
+		VisibleItems.Add(ItemPool[Row]);
+	}
+
+	if(ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void SValidatorXIssueBrowser::OnSearchTextChanged(const FText& Text)
+{
+	const FString NewSearchText = Text.ToString();
+	const bool bNarrow = !SearchText.IsEmpty() && NewSearchText.Contains(SearchText);
+	SearchText = NewSearchText;
+	Refresh(bNarrow);
+}
+
+ECheckBoxState SValidatorXIssueBrowser::GetSeverityState(EMessageSeverity::Type Severity) const
+{
+	return Facets.Severities.IsValidIndex(Severity) && Facets.Severities[Severity] ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SValidatorXIssueBrowser::OnSeverityStateChanged(ECheckBoxState NewState, EMessageSeverity::Type Severity)
+{
+	const bool bEnabled = NewState == ECheckBoxState::Checked;
+	Facets.Severities[Severity] = bEnabled;
+
+	// The warnings toggle covers performance warnings too
+	if(Severity == EMessageSeverity::Warning)
+	{
+		Facets.Severities[EMessageSeverity::PerformanceWarning] = bEnabled;
+	}
+	RefreshFacets();
+}
+
+FText SValidatorXIssueBrowser::GetSeverityLabel(EMessageSeverity::Type Severity) const
+{
+	auto GetCount = [this] (EMessageSeverity::Type CountedSeverity)
+		{
+			return SeverityCounts.IsValidIndex(CountedSeverity) ? SeverityCounts[CountedSeverity] : 0;
+		};
+
+	switch(Severity)
+	{
+	case EMessageSeverity::Error:   return FText::Format(INVTEXT("Errors ({0})"), FText::AsNumber(GetCount(EMessageSeverity::Error)));
+	case EMessageSeverity::Warning: return FText::Format(INVTEXT("Warnings ({0})"), FText::AsNumber(GetCount(EMessageSeverity::Warning) + GetCount(EMessageSeverity::PerformanceWarning)));
+	default:                        return FText::Format(INVTEXT("Info ({0})"), FText::AsNumber(GetCount(Severity)));
+	}
+}
+
+TSharedRef<SWidget> SValidatorXIssueBrowser::MakeFacetMenu(bool bValidators)
+{
+	FMenuBuilder MenuBuilder(false, nullptr);
+
+	// Values added after the last refresh are listed by the next one, with their counts
+	const int32 NumValues = bValidators ? ValidatorCounts.Num() : FolderCounts.Num();
+	for(int32 Index = 0; Index < NumValues; ++Index)
+	{
+		const FString Name = bValidators ? GetNameSafe(Table.GetValidatorClasses()[Index]) : Table.GetFolders()[Index].ToString();
+		const int32 Count = bValidators ? ValidatorCounts[Index] : FolderCounts[Index];
+
+		MenuBuilder.AddMenuEntry(
+			FText::Format(INVTEXT("{0} ({1})"), FText::FromString(Name), FText::AsNumber(Count)),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateLambda([this, bValidators, Index]
+					{
+						TBitArray<>& Bits = bValidators ? Facets.Validators : Facets.Folders;
+						Bits[Index] = !Bits[Index];
+						RefreshFacets();
+					}),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateLambda([this, bValidators, Index]
+					{
+						return bValidators ? bool(Facets.Validators[Index]) : bool(Facets.Folders[Index]);
+					})),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton);
+	}
+	return MenuBuilder.MakeWidget();
+}
+
+FText SValidatorXIssueBrowser::GetCellText(int32 Row, FName ColumnId) const
+{
+	if(Row >= Table.NumRows())
+	{
+		return FText::GetEmpty();
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Severity)
+	{
+		switch(Table.GetSeverity(Row))
+		{
+		case EMessageSeverity::Error:              return INVTEXT("Error");
+		case EMessageSeverity::PerformanceWarning: return INVTEXT("Performance");
+		case EMessageSeverity::Warning:            return INVTEXT("Warning");
+		default:                                   return INVTEXT("Info");
+		}
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Validator)
+	{
+		return FText::FromString(GetNameSafe(Table.GetValidator(Row)));
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Rule)
+	{
+		return FText::FromName(Table.GetRuleId(Row));
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Asset)
+	{
+		return FText::FromName(Table.GetPackageName(Row));
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Location)
+	{
+		const FName GraphName = Table.GetGraphName(Row);
+		const FName MemberName = Table.GetMemberName(Row);
+		if(!GraphName.IsNone() && !MemberName.IsNone())
+		{
+			return FText::Format(INVTEXT("{0} / {1}"), FText::FromName(GraphName), FText::FromName(MemberName));
+		}
+		return FText::FromName(GraphName.IsNone() ? MemberName : GraphName);
+	}
+	if(ColumnId == IssueBrowserColumns::ColumnID_Message)
+	{
+		const FValidatorXIssue Issue = Table.GetIssue(Row);
+		const UBlueprintValidatorBase* Validator = Issue.Validator ? Cast<UBlueprintValidatorBase>(Issue.Validator->GetDefaultObject()) : nullptr;
+		return Validator ? Validator->FormatIssue(Issue) : FText::FromName(Issue.RuleId);
+	}
+	return FText::GetEmpty();
+}
+
+void SValidatorXIssueBrowser::OnItemDoubleClicked(TSharedPtr<FValidatorXIssueBrowserItem> Item)
+{
+	if(Item.IsValid() && Item->Row < Table.NumRows())
+	{
+		ValidatorX::JumpToIssue(Table.GetIssue(Item->Row));
+	}
+}
+
+TSharedRef<ITableRow> SValidatorXIssueBrowser::OnGenerateRow(TSharedPtr<FValidatorXIssueBrowserItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SValidatorXIssueBrowserRow, OwnerTable)
+		.Item(Item)
+		.Browser(this);
+}
+
+FText SValidatorXIssueBrowser::GetSummaryText() const
+{
+	return FText::Format(INVTEXT("{0} of {1} issues ({2})"),
+		FText::AsNumber(Rows.Num()),
+		FText::AsNumber(Table.Num()),
+		FText::AsMemory(Table.GetAllocatedSize()));
+}
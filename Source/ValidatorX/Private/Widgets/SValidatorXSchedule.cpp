@@ -0,0 +1,179 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Widgets/SValidatorXSchedule.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "Reporting/ValidatorSchedule.h"
+#include "UObject/UObjectIterator.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+namespace ScheduleColumns
+{
+	static const FName ColumnID_Order("Order");
+	static const FName ColumnID_Validator("Validator");
+	static const FName ColumnID_AverageMs("AverageMs");
+	static const FName ColumnID_HitRate("HitRate");
+	static const FName ColumnID_Assets("Assets");
+	static const FName ColumnID_Expensive("Expensive");
+}
+
+class SValidatorXScheduleRow : public SMultiColumnTableRow<TSharedPtr<FValidatorXScheduleItem>>
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXScheduleRow) {}
+		SLATE_ARGUMENT(TSharedPtr<FValidatorXScheduleItem>, Item)
+		SLATE_ARGUMENT(const SValidatorXSchedule*, Schedule)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable)
+	{
+		Item = InArgs._Item;
+		Schedule = InArgs._Schedule;
+
+		SMultiColumnTableRow::Construct(FSuperRowType::FArguments()
+			.Style(FAppStyle::Get(), "ContentBrowser.AssetListView.ColumnListTableRow"), InOwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnId) override
+	{
+		return SNew(SBox)
+			.Padding(4.0f, 2.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+					.Text(Schedule->GetCellText(*Item, ColumnId))
+					.Justification(ColumnId == ScheduleColumns::ColumnID_Validator ? ETextJustify::Left : ETextJustify::Right)
+			];
+	}
+
+private:
+	TSharedPtr<FValidatorXScheduleItem> Item;
+	const SValidatorXSchedule* Schedule = nullptr;
+};
+
+void SValidatorXSchedule::Construct(const FArguments& InArgs)
+{
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.0f, 0.0f, 0.0f, 4.0f)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+					.ToolTipText(FText::FromString("When an asset being saved already has errors, skips the expensive validators (hierarchy lookups, cross-asset scans and validators averaging over 5 ms)"))
+					.IsChecked_Lambda([] { return FValidatorXValidatorSchedule::Get().IsFailFastEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+					.OnCheckStateChanged_Lambda([] (ECheckBoxState NewState) { FValidatorXValidatorSchedule::Get().SetFailFastEnabled(NewState == ECheckBoxState::Checked); })
+					[
+						SNew(STextBlock).Text(FText::FromString("Fail fast on save"))
+					]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+					.Text(FText::FromString("Refresh"))
+					.ToolTipText(FText::FromString("Orders the validators by their latest measurements"))
+					.OnClicked(this, &SValidatorXSchedule::OnRefresh)
+			]
+		]
+
+		+ SVerticalBox::Slot()
+		.FillHeight(1.0f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FValidatorXScheduleItem>>)
+				.ListItemsSource(&Items)
+				.OnGenerateRow(this, &SValidatorXSchedule::OnGenerateRow)
+				.SelectionMode(ESelectionMode::None)
+				.HeaderRow
+				(
+					SNew(SHeaderRow)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_Order).DefaultLabel(FText::FromString("#")).FixedWidth(40.0f)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_Validator).DefaultLabel(FText::FromString("Validator")).FillWidth(0.4f)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_AverageMs).DefaultLabel(FText::FromString("Avg ms")).FillWidth(0.15f)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_HitRate).DefaultLabel(FText::FromString("Hit Rate")).FillWidth(0.15f)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_Assets).DefaultLabel(FText::FromString("Assets")).FillWidth(0.15f)
+					+ SHeaderRow::Column(ScheduleColumns::ColumnID_Expensive).DefaultLabel(FText::FromString("Expensive")).FillWidth(0.15f)
+				)
+		]
+	];
+
+	OnRefresh();
+}
+
+FReply SValidatorXSchedule::OnRefresh()
+{
+	TArray<const UClass*> Validators;
+	for(TObjectIterator<UClass> It; It; ++It)
+	{
+		if(It->IsChildOf(UBlueprintValidatorBase::StaticClass()) && !It->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists))
+		{
+			Validators.Add(*It);
+		}
+	}
+	FValidatorXValidatorSchedule::Get().SortValidators(Validators);
+
+	Items.Reset(Validators.Num());
+	for(int32 Index = 0; Index < Validators.Num(); ++Index)
+	{
+		Items.Add(MakeShared<FValidatorXScheduleItem>(FValidatorXScheduleItem{ Validators[Index], Index + 1 }));
+	}
+
+	if(ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+	return FReply::Handled();
+}
+
+FText SValidatorXSchedule::GetCellText(const FValidatorXScheduleItem& Item, FName ColumnId) const
+{
+	const FValidatorXValidatorSchedule& Schedule = FValidatorXValidatorSchedule::Get();
+	const FValidatorXValidatorSchedule::FEntry* Entry = Schedule.Find(Item.Validator);
+
+	if(ColumnId == ScheduleColumns::ColumnID_Order)
+	{
+		return FText::AsNumber(Item.Order);
+	}
+	if(ColumnId == ScheduleColumns::ColumnID_Validator)
+	{
+		return FText::FromString(GetNameSafe(Item.Validator));
+	}
+	if(ColumnId == ScheduleColumns::ColumnID_Expensive)
+	{
+		return Schedule.IsExpensive(Cast<UBlueprintValidatorBase>(Item.Validator->GetDefaultObject())) ? INVTEXT("Yes") : FText::GetEmpty();
+	}
+	if(!Entry)
+	{
+		return INVTEXT("-");
+	}
+	if(ColumnId == ScheduleColumns::ColumnID_AverageMs)
+	{
+		FNumberFormattingOptions Options;
+		Options.SetMinimumFractionalDigits(2).SetMaximumFractionalDigits(2);
+		return FText::AsNumber(Entry->GetAverageMs(), &Options);
+	}
+	if(ColumnId == ScheduleColumns::ColumnID_HitRate)
+	{
+		return FText::AsPercent(Entry->GetHitRate());
+	}
+	if(ColumnId == ScheduleColumns::ColumnID_Assets)
+	{
+		return FText::AsNumber(Entry->NumAssets);
+	}
+	return FText::GetEmpty();
+}
+
+TSharedRef<ITableRow> SValidatorXSchedule::OnGenerateRow(TSharedPtr<FValidatorXScheduleItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SValidatorXScheduleRow, OwnerTable)
+		.Item(Item)
+		.Schedule(this);
+}
@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAssetData;
+class UBlueprint;
+
+/**
+ * Asset registry tags ValidatorX writes on every Blueprint it sees saved, next to the engine's own Blueprint tags.
+ * Batch runs read them through FAssetData to skip assets a validator cannot have findings on without loading them,
+ * and project-wide queries (worst Blueprints, dashboards) run from the registry alone.
+ */
+namespace ValidatorX::AssetTags
+{
+	/** Member variables, dispatchers included */
+	inline const FName NumVariables(TEXT("ValidatorX.NumVariables"));
+
+	/** Function graphs, the construction script included */
+	inline const FName NumFunctions(TEXT("ValidatorX.NumFunctions"));
+
+	inline const FName NumMacros(TEXT("ValidatorX.NumMacros"));
+	inline const FName NumDispatchers(TEXT("ValidatorX.NumDispatchers"));
+
+	/** See FValidatorXBlueprintMetrics */
+	inline const FName NumGraphs(TEXT("ValidatorX.NumGraphs"));
+	inline const FName NumNodes(TEXT("ValidatorX.NumNodes"));
+	inline const FName MaxGraphNodes(TEXT("ValidatorX.MaxGraphNodes"));
+	inline const FName NumMacroInstances(TEXT("ValidatorX.NumMacroInstances"));
+
+	/** Implemented per-frame events: actor and component tick, widget tick, animation update */
+	inline const FName NumTickingEvents(TEXT("ValidatorX.NumTickingEvents"));
+
+	/** 1 when the class default object of an actor or component Blueprint has bCanEverTick set, 0 otherwise */
+	inline const FName CanEverTick(TEXT("ValidatorX.CanEverTick"));
+
+	/** Packages the Blueprint hard-references directly, see CollectHardReferenceEdges */
+	inline const FName NumHardReferences(TEXT("ValidatorX.NumHardReferences"));
+
+	/** EstimateNodesCost over everything the per-frame events execute */
+	inline const FName EstimatedTickCost(TEXT("ValidatorX.EstimatedTickCost"));
+
+	/** Warnings and errors of the latest validation in the session that saved the asset, and their combined fingerprint in hex */
+	inline const FName NumIssues(TEXT("ValidatorX.NumIssues"));
+	inline const FName LastValidationFingerprint(TEXT("ValidatorX.LastValidationFingerprint"));
+}
+
+namespace ValidatorX
+{
+	/** Registers the tag writer with the asset registry tag gathering of every object, see UnregisterAssetTags */
+	VALIDATORX_API void RegisterAssetTags();
+	VALIDATORX_API void UnregisterAssetTags();
+
+	/**
+	 * Numeric tag value of an asset.
+	 *
+	 * @return The value, INDEX_NONE when the asset was saved without the tag (e.g. before ValidatorX was installed)
+	 */
+	VALIDATORX_API int32 GetAssetTagCount(const FAssetData& AssetData, FName Tag);
+
+	/** Combined issue fingerprint written by the last save after a validation, 0 when the tag is missing */
+	VALIDATORX_API uint64 GetAssetTagFingerprint(const FAssetData& AssetData);
+
+	/** True when the registry says the Blueprint only overrides defaults: no graphs, variables or components of its own */
+	VALIDATORX_API bool IsDataOnlyBlueprint(const FAssetData& AssetData);
+
+	/** True when the native parent class of the Blueprint is Class or derives from it; also true when the tag is missing */
+	VALIDATORX_API bool IsNativeParentChildOf(const FAssetData& AssetData, const UClass* Class);
+
+	/** True when the generated class of the Blueprint was saved with any of the flags; false when the tag is missing */
+	VALIDATORX_API bool HasGeneratedClassFlags(const FAssetData& AssetData, EClassFlags Flags);
+}
@@ -0,0 +1,29 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraphNode;
+
+namespace ValidatorX
+{
+	/**
+	 * Unitless static estimate of the cost of executing a node once. Variable access is 1,
+	 * regular calls a few units, loops, world queries and object creation a lot more.
+	 * Only meant for ranking and budgets, not for absolute timings.
+	 */
+	VALIDATORX_API int32 EstimateNodeCost(const UEdGraphNode* Node);
+
+	/** Sum of EstimateNodeCost over a set of nodes */
+	VALIDATORX_API int32 EstimateNodesCost(const TSet<UEdGraphNode*>& Nodes);
+
+	/** Returns true for calls that query or iterate the whole world or widget tree (GetAllActorsOfClass, traces, ...) */
+	VALIDATORX_API bool IsWorldQueryNode(const UEdGraphNode* Node);
+
+	/** Returns true for nodes that construct objects, actors or widgets */
+	VALIDATORX_API bool IsObjectCreationNode(const UEdGraphNode* Node);
+
+	/** Returns true for ForEach/For/While loop macro instances */
+	VALIDATORX_API bool IsLoopMacroNode(const UEdGraphNode* Node);
+}
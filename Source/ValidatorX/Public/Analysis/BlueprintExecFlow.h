@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraphNode;
+class UK2Node_Event;
+
+namespace ValidatorX
+{
+	/**
+	 * Finds the event node implementing the given event in the Blueprint's event graphs.
+	 *
+	 * @param Blueprint     Blueprint to search
+	 * @param EventName     Function name of the event (e.g. ReceiveTick) or custom event name
+	 * @return Event node, null if the Blueprint does not implement the event
+	 */
+	VALIDATORX_API UK2Node_Event* FindEventNode(const UBlueprint* Blueprint, FName EventName);
+
+	/**
+	 * Collects every node executed when the given roots fire. Exec links are followed, calls to the
+	 * Blueprint's own functions and custom events are followed into their implementations, and pure
+	 * nodes feeding a reached node are included since they are evaluated with it.
+	 *
+	 * @param Blueprint     Blueprint owning the roots
+	 * @param Roots         Nodes to start from (usually event or function entry nodes)
+	 * @param OutNodes      Reached nodes, roots included
+	 */
+	VALIDATORX_API void CollectExecReachableNodes(const UBlueprint* Blueprint, TArrayView<UEdGraphNode* const> Roots, TSet<UEdGraphNode*>& OutNodes);
+
+	/** Returns true if the node has at least one exec pin, i.e. it is part of the execution flow */
+	VALIDATORX_API bool HasExecPins(const UEdGraphNode* Node);
+}
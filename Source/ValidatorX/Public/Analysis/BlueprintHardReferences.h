@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UEdGraph;
+class UEdGraphNode;
+
+/** What inside a Blueprint introduces a hard reference to another package */
+enum class EValidatorXReferenceKind : uint8
+{
+	ParentClass,
+	Variable,
+	Cast,
+	SpawnNode,
+	FunctionCall,
+	PinType,
+	PinDefault
+};
+
+/**
+ * A single hard reference from a Blueprint to another package, together with the
+ * node or variable that introduces it.
+ */
+struct FValidatorXReferenceEdge
+{
+	/** Package that gets loaded because of this reference */
+	FName PackageName;
+
+	/** Referenced object (class, struct or asset) */
+	const UObject* ReferencedObject = nullptr;
+
+	EValidatorXReferenceKind Kind = EValidatorXReferenceKind::PinType;
+
+	/** Variable name or node title, used in messages */
+	FString SourceName;
+
+	/** Graph and node introducing the reference, null for variables and the parent class */
+	UEdGraph* Graph = nullptr;
+	UEdGraphNode* Node = nullptr;
+};
+
+namespace ValidatorX
+{
+	/**
+	 * Collects every hard reference a Blueprint holds to other content packages.
+	 * Script packages and the Blueprint's own package are skipped.
+	 *
+	 * @param Blueprint     Blueprint to inspect
+	 * @param OutEdges      Unique references, one per (package, node or variable)
+	 */
+	VALIDATORX_API void CollectHardReferenceEdges(const UBlueprint* Blueprint, TArray<FValidatorXReferenceEdge>& OutEdges);
+
+	/** Human readable name of a reference kind */
+	VALIDATORX_API const TCHAR* LexReferenceKind(EValidatorXReferenceKind Kind);
+}
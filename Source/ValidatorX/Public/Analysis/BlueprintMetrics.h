@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+
+/** Structural size metrics of a Blueprint, counted over every graph including macros and collapsed graphs */
+struct FValidatorXBlueprintMetrics
+{
+	int32 NumGraphs = 0;
+
+	/** Nodes excluding comments and reroute knots */
+	int32 NumNodes = 0;
+
+	/** Node count of the largest graph */
+	int32 MaxGraphNodes = 0;
+
+	int32 NumMacroInstances = 0;
+};
+
+namespace ValidatorX
+{
+	VALIDATORX_API FValidatorXBlueprintMetrics GatherBlueprintMetrics(const UBlueprint* Blueprint);
+}
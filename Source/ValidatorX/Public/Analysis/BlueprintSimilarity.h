@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class FValidatorXSnapshotReader;
+
+namespace ValidatorX
+{
+	/**
+	 * Collects the node-feature shingles of a Blueprint: one per node (class plus target member, see
+	 * GetCanonicalNodeKey) and one per linked pair of nodes, so both content and wiring contribute.
+	 * Shingles are stable 64-bit hashes, sorted and unique.
+	 */
+	VALIDATORX_API void CollectBlueprintShingles(const UBlueprint* Blueprint, TArray<uint64>& OutShingles);
+
+	/** Same shingles as CollectBlueprintShingles, read from a snapshot shard without loading the Blueprint */
+	VALIDATORX_API void CollectSnapshotShingles(const FValidatorXSnapshotReader& Snapshot, int32 BlueprintIndex, TArray<uint64>& OutShingles);
+}
+
+/**
+ * MinHash signatures with LSH banding over shingle sets.
+ * Signatures are stored in one flat array. Each band of rows is hashed into a bucket and only Blueprints
+ * sharing at least one bucket are compared, so finding similar pairs avoids the all-pairs comparison.
+ */
+class VALIDATORX_API FValidatorXMinHashIndex
+{
+public:
+	struct FSimilarPair
+	{
+		int32 A = INDEX_NONE;
+		int32 B = INDEX_NONE;
+
+		/** Estimated Jaccard similarity, the fraction of matching signature rows */
+		float Similarity = 0.0f;
+	};
+
+	/**
+	 * @param InNumBands        Number of LSH bands
+	 * @param InRowsPerBand     Signature rows per band, the signature has NumBands * RowsPerBand rows
+	 */
+	FValidatorXMinHashIndex(int32 InNumBands, int32 InRowsPerBand);
+
+	/** Computes the signature of a shingle set and returns its item index. Empty sets never match anything. */
+	int32 Add(TConstArrayView<uint64> Shingles);
+
+	int32 Num() const { return NumItems; }
+
+	/** Returns every candidate pair whose estimated similarity is at least MinSimilarity */
+	void FindSimilarPairs(float MinSimilarity, TArray<FSimilarPair>& OutPairs) const;
+
+	/** Groups items connected by similar pairs (union-find), only groups of two or more are returned */
+	static void BuildClusters(int32 NumItems, const TArray<FSimilarPair>& Pairs, TArray<TArray<int32>>& OutClusters);
+
+private:
+	float EstimateSimilarity(int32 A, int32 B) const;
+
+	int32 NumBands;
+	int32 RowsPerBand;
+	int32 NumRows;
+	int32 NumItems = 0;
+
+	TArray<uint64> Seeds;
+	TArray<uint64> Signatures;
+	TArray<TMap<uint64, TArray<int32>>> BandBuckets;
+};
@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * Compact binary snapshot of Blueprint graph topology, one shard file per batch of Blueprints.
+ *
+ * A shard is a header followed by flat arrays of fixed-size records and one string table. Records refer
+ * to each other and to strings by index only, so a shard can be memory-mapped and read in place without
+ * any parsing or UE package loading. Records are 4 or 8 byte aligned and stored in native byte order.
+ */
+namespace ValidatorX::Snapshot
+{
+	constexpr uint32 Magic = 0x4E535856; // "VXSN"
+	constexpr uint32 Version = 3; // 3: string pool no longer folds case
+	constexpr uint32 InvalidIndex = MAX_uint32;
+
+	enum class ESection : uint32
+	{
+		Blueprints,
+		Graphs,
+		Nodes,
+		Pins,
+		Links,
+		Variables,
+		StringOffsets,
+		StringData,
+		Count
+	};
+
+	enum class EGraphKind : uint32
+	{
+		Ubergraph,
+		Function,
+		Macro,
+		Other
+	};
+
+	enum ENodeFlags : uint32
+	{
+		NodeFlag_HasExecPins = 1 << 0,
+		NodeFlag_Comment = 1 << 1,
+		NodeFlag_Knot = 1 << 2,
+		NodeFlag_Disabled = 1 << 3,
+	};
+
+	enum EPinFlags : uint8
+	{
+		PinFlag_Exec = 1 << 0,
+		PinFlag_Hidden = 1 << 1,
+	};
+
+	struct FSection
+	{
+		uint64 Offset = 0;
+		uint64 Num = 0;
+	};
+
+	struct FHeader
+	{
+		uint32 Magic = Snapshot::Magic;
+		uint32 Version = Snapshot::Version;
+		FSection Sections[static_cast<uint32>(ESection::Count)];
+	};
+
+	struct FBlueprintRecord
+	{
+		uint32 PackageName;
+		uint32 BlueprintClass;
+		uint32 ParentClass;
+		uint32 FirstGraph;
+		uint32 NumGraphs;
+		uint32 FirstVariable;
+		uint32 NumVariables;
+	};
+
+	struct FGraphRecord
+	{
+		uint32 Name;
+		EGraphKind Kind;
+		uint32 FirstNode;
+		uint32 NumNodes;
+	};
+
+	struct FNodeRecord
+	{
+		uint32 Class;
+
+		/** Canonical node key, see ValidatorX::GetCanonicalNodeKey */
+		uint32 Key;
+		uint32 MemberName;
+		uint32 MemberParent;
+		int32 PosX;
+		int32 PosY;
+		uint32 FirstPin;
+		uint32 NumPins;
+		uint32 Flags;
+		uint32 Guid[4];
+	};
+
+	struct FPinRecord
+	{
+		uint32 Node;
+		uint32 Name;
+		uint32 Category;
+		uint32 DefaultValue;
+		uint32 FirstLink;
+		uint32 NumLinks;
+		uint8 Direction;
+		uint8 Flags;
+		/** Zero, keeps the record size explicit */
+		uint16 Reserved;
+	};
+
+	/** Index of the linked pin */
+	struct FLinkRecord
+	{
+		uint32 TargetPin;
+	};
+
+	struct FVariableRecord
+	{
+		uint32 Name;
+		uint32 Category;
+		uint32 SubCategoryObject;
+		uint32 ReplicationCondition;
+		uint64 PropertyFlags;
+	};
+
+	/** String pool keys compare case-sensitively: pin defaults, names and node keys are hashed exactly as written */
+	struct FStringKeyFuncs : TDefaultMapHashableKeyFuncs<FString, uint32, false>
+	{
+		static bool Matches(const FString& A, const FString& B)
+		{
+			return A.Equals(B, ESearchCase::CaseSensitive);
+		}
+
+		static uint32 GetKeyHash(const FString& Key)
+		{
+			return FCrc::StrCrc32(*Key);
+		}
+	};
+
+	static_assert(sizeof(FHeader) == 8 + 16 * static_cast<uint32>(ESection::Count), "Snapshot header layout changed, bump Version");
+	static_assert(sizeof(FNodeRecord) == 52, "Snapshot node layout changed, bump Version");
+	static_assert(sizeof(FPinRecord) == 28, "Snapshot pin layout changed, bump Version");
+	static_assert(sizeof(FVariableRecord) == 24, "Snapshot variable layout changed, bump Version");
+}
+
+/** Accumulates Blueprints into one shard and writes it in a single pass */
+class VALIDATORX_API FValidatorXSnapshotWriter
+{
+public:
+	void AddBlueprint(const UBlueprint* Blueprint);
+
+	int32 NumBlueprints() const { return Blueprints.Num(); }
+
+	/** Writes the shard and clears the writer for the next batch */
+	bool Save(const FString& FilePath);
+
+private:
+	uint32 AddString(const FString& Value);
+
+	TArray<ValidatorX::Snapshot::FBlueprintRecord> Blueprints;
+	TArray<ValidatorX::Snapshot::FGraphRecord> Graphs;
+	TArray<ValidatorX::Snapshot::FNodeRecord> Nodes;
+	TArray<ValidatorX::Snapshot::FPinRecord> Pins;
+	TArray<ValidatorX::Snapshot::FLinkRecord> Links;
+	TArray<ValidatorX::Snapshot::FVariableRecord> Variables;
+	TArray<uint32> StringOffsets;
+	TArray<uint8> StringData;
+	TMap<FString, uint32, FDefaultSetAllocator, ValidatorX::Snapshot::FStringKeyFuncs> StringIndices;
+};
+
+/** Read-only view of a shard, memory-mapped when the platform supports it */
+class VALIDATORX_API FValidatorXSnapshotReader
+{
+public:
+	FValidatorXSnapshotReader();
+	~FValidatorXSnapshotReader();
+
+	/** Maps the shard and validates its header and section bounds */
+	bool Open(const FString& FilePath);
+
+	TConstArrayView<ValidatorX::Snapshot::FBlueprintRecord> GetBlueprints() const { return GetSection<ValidatorX::Snapshot::FBlueprintRecord>(ValidatorX::Snapshot::ESection::Blueprints); }
+	TConstArrayView<ValidatorX::Snapshot::FGraphRecord> GetGraphs() const { return GetSection<ValidatorX::Snapshot::FGraphRecord>(ValidatorX::Snapshot::ESection::Graphs); }
+	TConstArrayView<ValidatorX::Snapshot::FNodeRecord> GetNodes() const { return GetSection<ValidatorX::Snapshot::FNodeRecord>(ValidatorX::Snapshot::ESection::Nodes); }
+	TConstArrayView<ValidatorX::Snapshot::FPinRecord> GetPins() const { return GetSection<ValidatorX::Snapshot::FPinRecord>(ValidatorX::Snapshot::ESection::Pins); }
+	TConstArrayView<ValidatorX::Snapshot::FLinkRecord> GetLinks() const { return GetSection<ValidatorX::Snapshot::FLinkRecord>(ValidatorX::Snapshot::ESection::Links); }
+	TConstArrayView<ValidatorX::Snapshot::FVariableRecord> GetVariables() const { return GetSection<ValidatorX::Snapshot::FVariableRecord>(ValidatorX::Snapshot::ESection::Variables); }
+
+	/** UTF-8 view into the string table, empty for InvalidIndex */
+	FUtf8StringView GetString(uint32 Index) const;
+
+private:
+	template<typename RecordType>
+	TConstArrayView<RecordType> GetSection(ValidatorX::Snapshot::ESection Section) const
+	{
+		if(!Header)
+		{
+			return TConstArrayView<RecordType>();
+		}
+
+		const ValidatorX::Snapshot::FSection& Entry = Header->Sections[static_cast<uint32>(Section)];
+		return TConstArrayView<RecordType>(reinterpret_cast<const RecordType*>(Data + Entry.Offset), static_cast<int32>(Entry.Num));
+	}
+
+	TUniquePtr<IMappedFileHandle> MappedHandle;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray64<uint8> FileData;
+
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	const ValidatorX::Snapshot::FHeader* Header = nullptr;
+};
@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/BlueprintMetrics.h"
+
+class UBlueprint;
+
+struct FValidatorXCompileSample
+{
+	FName PackageName;
+
+	/** Unix time of the measurement */
+	int64 Timestamp = 0;
+
+	double CompileMs = 0.0;
+	bool bSucceeded = true;
+	FValidatorXBlueprintMetrics Metrics;
+
+	/**
+	 * Compile time attributed to each graph. The Kismet compiler only reports whole-Blueprint timings,
+	 * so this is the total split by each graph's share of the nodes. Not persisted.
+	 */
+	TArray<TPair<FName, double>> EstimatedGraphMs;
+};
+
+/**
+ * Compiles Blueprints through the Kismet compiler with timing and keeps a history of the measurements.
+ * Every measurement is appended to Saved/ValidatorX/CompileHistory.csv so trends stay visible across runs;
+ * in memory only the latest and previous sample of each package are kept.
+ */
+class VALIDATORX_API FValidatorXCompileProfiler
+{
+	FValidatorXCompileProfiler() {}
+	FValidatorXCompileProfiler(const FValidatorXCompileProfiler&) = delete;
+	FValidatorXCompileProfiler& operator=(const FValidatorXCompileProfiler&) = delete;
+
+public:
+	static FValidatorXCompileProfiler& Get()
+	{
+		static FValidatorXCompileProfiler Instance;
+		return Instance;
+	}
+
+	/** Compiles the Blueprint, records the sample and returns it. Call Flush() to persist. */
+	FValidatorXCompileSample ProfileBlueprint(UBlueprint* Blueprint);
+
+	/** Latest recorded sample of a package, from this or a previous run */
+	const FValidatorXCompileSample* FindLatest(FName PackageName) const;
+
+	/** Sample recorded before the latest one, used to show the trend */
+	const FValidatorXCompileSample* FindPrevious(FName PackageName) const;
+
+	/** Reads the history file, keeping the latest two samples of each package */
+	void Load();
+
+	/** Appends the samples recorded since the last Flush to the history file */
+	void Flush();
+
+	/**
+	 * Pearson correlation of compile time with node count, macro instance count and graph count.
+	 *
+	 * @return Human readable summary, e.g. "nodes r=0.81, macro instances r=0.42, graphs r=0.30"
+	 */
+	static FString DescribeCorrelations(TConstArrayView<FValidatorXCompileSample> Samples);
+
+private:
+	struct FHistory
+	{
+		FValidatorXCompileSample Latest;
+		TOptional<FValidatorXCompileSample> Previous;
+	};
+
+	void Record(const FValidatorXCompileSample& Sample);
+	static FString GetFilePath();
+
+	TMap<FName, FHistory> Histories;
+	TArray<FValidatorXCompileSample> PendingSamples;
+	bool bLoaded = false;
+};
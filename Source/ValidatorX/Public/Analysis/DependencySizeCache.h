@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Asset registry backed cache of package disk sizes and transitive hard-dependency closures.
+ * Nothing is loaded: all data comes from the registry. Closures are memoised per package and
+ * reused while computing the closures of their referencers, so full-project runs stay near-linear.
+ */
+class VALIDATORX_API FValidatorXDependencyCache
+{
+	FValidatorXDependencyCache() {}
+	FValidatorXDependencyCache(const FValidatorXDependencyCache&) = delete;
+	FValidatorXDependencyCache& operator=(const FValidatorXDependencyCache&) = delete;
+
+public:
+	struct FClosureInfo
+	{
+		/** Sum of the on-disk sizes of every package in the closure, including the root package */
+		int64 TotalBytes = 0;
+
+		/** Number of packages in the closure, including the root package */
+		int32 PackageCount = 0;
+	};
+
+	static FValidatorXDependencyCache& Get()
+	{
+		static FValidatorXDependencyCache Instance;
+		return Instance;
+	}
+
+	/**
+	 * Returns the on-disk size of a single package.
+	 *
+	 * @param PackageName   Long package name (e.g. /Game/Characters/BP_Hero)
+	 * @return Size in bytes, 0 for script or unknown packages
+	 */
+	int64 GetPackageSize(FName PackageName);
+
+	/**
+	 * Returns the number of direct hard package dependencies of a package.
+	 */
+	int32 GetDirectDependencyCount(FName PackageName);
+
+	/**
+	 * Returns the transitive hard-dependency closure summary of a package.
+	 *
+	 * @param PackageName   Long package name
+	 * @return Closure summary, memoised until the next Reset()
+	 */
+	FClosureInfo GetClosure(FName PackageName);
+
+	/** Drops every cached entry. Called whenever packages are saved so stale sizes are not reported. */
+	void Reset();
+
+private:
+	struct FPackageEntry
+	{
+		FName PackageName;
+		int64 DiskSize = 0;
+		TArray<int32> Dependencies;
+		TArray<int32> Closure;
+		FClosureInfo Summary;
+		bool bDependenciesGathered = false;
+		bool bClosureComputed = false;
+	};
+
+	int32 FindOrAddPackage(FName PackageName);
+	void GatherDependencies(int32 Index);
+	void ComputeClosure(int32 RootIndex);
+
+	TArray<FPackageEntry> Packages;
+	TMap<FName, int32> PackageIndices;
+
+	/** Per-package visit stamps, avoids clearing a visited set for every closure query */
+	TArray<uint32> VisitStamps;
+	uint32 CurrentStamp = 0;
+};
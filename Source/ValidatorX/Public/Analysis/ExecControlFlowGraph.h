@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+class UEdGraphPin;
+
+/**
+ * Exec-only control flow graph of a single UEdGraph. Index 0 is a virtual root linked to every
+ * entry (events, function entries, chains without an exec input). Calls to custom events implemented
+ * in the same graph are modelled as edges to the event, so event/Delay loops become real cycles.
+ */
+class VALIDATORX_API FValidatorXExecGraph
+{
+public:
+	static constexpr int32 RootIndex = 0;
+
+	/** Builds the graph, only nodes with exec pins take part */
+	void Build(const UEdGraph* Graph);
+
+	/**
+	 * Computes immediate dominators with the Cooper-Harvey-Kennedy iterative algorithm,
+	 * which is close to linear on the reducible graphs Blueprints produce.
+	 *
+	 * @param OutImmediateDominators    Per node index, INDEX_NONE for unreachable nodes. The root dominates itself.
+	 */
+	void ComputeDominators(TArray<int32>& OutImmediateDominators) const;
+
+	/**
+	 * Collects the natural loop of a back edge (Latch -> Header where Header dominates Latch):
+	 * every node that reaches Latch without passing through Header, plus Header.
+	 */
+	void CollectNaturalLoop(int32 Header, int32 Latch, TArray<int32>& OutBody) const;
+
+	int32 Num() const { return Nodes.Num(); }
+	int32 FindIndex(const UEdGraphNode* Node) const;
+
+	/** Graph node for an index, null for the root */
+	TArray<UEdGraphNode*> Nodes;
+	TArray<TArray<int32>> Successors;
+	TArray<TArray<int32>> Predecessors;
+
+private:
+	void AddEdge(int32 From, int32 To);
+
+	TMap<const UEdGraphNode*, int32> NodeIndices;
+};
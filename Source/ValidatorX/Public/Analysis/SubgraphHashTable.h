@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Project-wide table of subgraph cluster hashes (see FValidatorXSubgraphHasher).
+ * Only hashes and node locations are stored, never graphs, so Blueprints can be unloaded as soon as they
+ * are hashed. Every package's clusters are replaced as a whole when it is validated again, and the table
+ * is persisted under Saved/ValidatorX so duplicates are found across editor sessions.
+ */
+class VALIDATORX_API FValidatorXSubgraphHashTable
+{
+	FValidatorXSubgraphHashTable() {}
+	FValidatorXSubgraphHashTable(const FValidatorXSubgraphHashTable&) = delete;
+	FValidatorXSubgraphHashTable& operator=(const FValidatorXSubgraphHashTable&) = delete;
+
+public:
+	struct FClusterRecord
+	{
+		uint64 Hash = 0;
+		FName GraphName;
+		FGuid NodeGuid;
+		int32 Size = 0;
+
+		friend FArchive& operator<<(FArchive& Ar, FClusterRecord& Record)
+		{
+			return Ar << Record.Hash << Record.GraphName << Record.NodeGuid << Record.Size;
+		}
+	};
+
+	struct FLocation
+	{
+		FName PackageName;
+		FName GraphName;
+		FGuid NodeGuid;
+	};
+
+	static FValidatorXSubgraphHashTable& Get()
+	{
+		static FValidatorXSubgraphHashTable Instance;
+		return Instance;
+	}
+
+	/** Replaces every cluster previously recorded for the package */
+	void ReplacePackage(FName PackageName, TArray<FClusterRecord>&& Records);
+
+	/**
+	 * Finds a cluster with the given hash recorded by another package.
+	 *
+	 * @param Hash          Exact cluster hash
+	 * @param PackageName   Package asking, its own clusters are ignored
+	 * @param OutPackageCount   Number of packages containing the cluster, including the asking one if it is recorded
+	 * @return Location of one occurrence in another package, null if there is none
+	 */
+	const FLocation* FindInOtherPackage(uint64 Hash, FName PackageName, int32& OutPackageCount) const;
+
+	/** Number of packages with recorded clusters */
+	int32 NumPackages() const { return PackageRecords.Num(); }
+
+	/** Loads the table from Saved/ValidatorX, replacing the current content */
+	void Load();
+
+	/** Writes the table to Saved/ValidatorX if it changed since the last Load/Save */
+	void Save();
+
+	void Reset();
+
+private:
+	struct FHashEntry
+	{
+		/** The first two packages are enough to always point at "another" occurrence */
+		TArray<FLocation, TInlineAllocator<2>> Locations;
+		int32 PackageCount = 0;
+	};
+
+	void AddToIndex(FName PackageName, const TArray<FClusterRecord>& Records);
+	void RemoveFromIndex(FName PackageName, const TArray<FClusterRecord>& Records);
+	static FString GetFilePath();
+
+	TMap<FName, TArray<FClusterRecord>> PackageRecords;
+	TMap<uint64, FHashEntry> HashIndex;
+	bool bDirty = false;
+};
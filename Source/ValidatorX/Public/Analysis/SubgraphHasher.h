@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEdGraph;
+class UEdGraphNode;
+
+namespace ValidatorX
+{
+	/** Stable 64-bit hash of the UTF-8 form of a string, identical across processes and platforms (unlike FName hashes) */
+	VALIDATORX_API uint64 HashStableString(const FString& Value);
+
+	/** Order dependent combination of two 64-bit hashes */
+	VALIDATORX_API uint64 CombineStableHash(uint64 A, uint64 B);
+
+	/** Canonical identity of a node: class plus the member it references (function, variable, macro, cast target...) */
+	VALIDATORX_API FString GetCanonicalNodeKey(const UEdGraphNode* Node);
+}
+
+/**
+ * Canonical Merkle hashing of node clusters inside one graph.
+ *
+ * A node's data hash combines its class, member reference and unlinked pin defaults with the data hashes
+ * of the pure nodes feeding it, computed bottom-up. An exec cluster hash folds the data hashes of a fixed
+ * number of consecutive exec steps. Every node is hashed once per variant, so hashing is linear in the size
+ * of the graph. The structural variant ignores literal pin values and is used to find near-duplicates.
+ */
+class VALIDATORX_API FValidatorXSubgraphHasher
+{
+public:
+	struct FCluster
+	{
+		UEdGraphNode* RootNode = nullptr;
+
+		/** Exact hash (pin defaults included) */
+		uint64 Hash = 0;
+
+		/** Structural hash (pin defaults ignored) */
+		uint64 StructureHash = 0;
+
+		/** Number of nodes folded into the hash */
+		int32 Size = 0;
+	};
+
+	/**
+	 * @param InChainLength     Number of consecutive exec steps that make up one exec cluster
+	 */
+	explicit FValidatorXSubgraphHasher(int32 InChainLength)
+		: ChainLength(FMath::Max(1, InChainLength))
+	{
+	}
+
+	/**
+	 * Hashes the graph and returns every cluster with at least MinSize nodes: one exec cluster per exec
+	 * node, plus one per pure expression tree whose result is consumed by an exec node.
+	 */
+	void CollectClusters(const UEdGraph* Graph, int32 MinSize, TArray<FCluster>& OutClusters);
+
+private:
+	struct FNodeHashes
+	{
+		uint64 Hash = 0;
+		uint64 StructureHash = 0;
+		int32 Size = 0;
+		bool bInProgress = false;
+		bool bDone = false;
+	};
+
+	FNodeHashes GetDataHashes(const UEdGraphNode* Node);
+	FNodeHashes GetChainHashes(const UEdGraphNode* Node, int32 RemainingSteps);
+
+	int32 ChainLength;
+	TMap<const UEdGraphNode*, FNodeHashes> DataHashes;
+	TMap<TPair<const UEdGraphNode*, int32>, FNodeHashes> ChainHashes;
+};
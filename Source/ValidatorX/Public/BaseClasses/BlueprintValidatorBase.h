@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "EditorValidatorBase.h"
 #include "Interface/ValidatorToggleInterface.h"
+#include "Reporting/ValidationIssue.h"
+#include "Reporting/ValidatorStats.h"
 #include "BlueprintValidatorBase.generated.h"
 
 /**
@@ -26,9 +28,115 @@ public:
 		return TEXT("Blueprint");
 	}
 #pragma region IValidatorToggleInterface
-	virtual void ToggleValidationEnabled() override {}
-	virtual void SetValidationEnabled(bool bEnabled) override {}
+	virtual void ToggleValidationEnabled() override;
+
+	/**
+	 * Enables or disables the validator class: the state lives on the class default object, shared by the editor
+	 * validator subsystem, batch runs and the ValidatorX tab, and is written to the config through
+	 * FValidatorXConfigManager. Does nothing for validators disabled in the config file and during construction.
+	 */
+	virtual void SetValidationEnabled(bool bEnabled) override;
 #pragma endregion
+	/** Enabled state of the class, false while disabled in the config file */
+	virtual bool IsEnabled() const override;
+
+	/** Disabled in the config file, toggles and presets leave it off */
+	bool IsConfigDisabled() const
+	{
+		return bIsConfigDisabled;
+	}
+
 	bool bIsError = false;
 
-};
+	/**
+	 * Builds the message text of an issue recorded by this validator. Only called when the issue is displayed,
+	 * possibly long after validation, so it must rely on the record alone.
+	 *
+	 * @param Issue   Record built by MakeIssue
+	 * @return Message text
+	 */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const;
+
+	/** Adds the action tokens (jump, fix...) of a displayed issue. Defaults to a jump to its node, graph or member. */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const;
+
+	/**
+	 * Cheap registry-only predicate, checked by batch runs before anything is loaded. Returns false only when the
+	 * asset cannot have findings according to its registry tags (see BlueprintAssetTags); when a tag is missing it
+	 * must assume the asset may have some. Defaults to any Blueprint.
+	 *
+	 * @param InAssetData   Registry data of the asset, the asset itself may not be loaded
+	 * @return True if the asset has to be loaded and validated
+	 */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const;
+
+	/**
+	 * Validates an asset without going through the editor validator subsystem, used by the commandlet.
+	 * Skips validators disabled by config and assets the validator does not handle, by registry data or loaded asset.
+	 */
+	EDataValidationResult RunValidation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context);
+
+	/** Hierarchy lookups and cross-asset scans, skipped by the fail-fast policy once an asset has errors (see ValidatorSchedule) */
+	virtual bool IsExpensive() const
+	{
+		return false;
+	}
+
+	/** True when AddIssueTokens offers an automatic fix for the issue, written to reports */
+	virtual bool HasIssueFix(const FValidatorXIssue& Issue) const
+	{
+		return false;
+	}
+
+protected:
+	/**
+	 * Resets bIsError and drops the records of the previous validation of the asset; call it first in ValidateLoadedAsset.
+	 *
+	 * @return Scope timing the validation for the per-validator summary of reports, keep it until the validation returns
+	 */
+	[[nodiscard]] FValidatorXValidationScope BeginIssues(const UObject* Asset);
+
+	/**
+	 * Starts an issue record. Arguments for FormatIssue are appended with FValidatorXIssue::Add.
+	 *
+	 * @param RuleId      Rule of this validator, part of the fingerprint
+	 * @param Severity    Message severity; warnings and errors set bIsError when reported
+	 * @param Asset       Asset the issue is reported on
+	 * @param Node        Node the issue is attached to, null for asset-wide issues
+	 * @param MemberName  Pin or member of the node the issue is about, distinguishes several issues on one node
+	 */
+	FValidatorXIssue MakeIssue(FName RuleId, EMessageSeverity::Type Severity, const UObject* Asset, const UEdGraphNode* Node = nullptr, FName MemberName = NAME_None) const;
+
+	/** Same as above for issues attached to a member (variable, function, dispatcher...), optionally scoped to a graph */
+	FValidatorXIssue MakeIssue(FName RuleId, EMessageSeverity::Type Severity, const UObject* Asset, FName MemberName, const UEdGraph* Graph = nullptr) const;
+
+	/**
+	 * False when fail-fast is on, the asset is being saved, it already has errors in this context and this validator
+	 * is expensive. Checked by CanValidateAsset, where the editor validator subsystem asks.
+	 */
+	bool PassesFailFast(const FDataValidationContext& Context) const;
+
+	/**
+	 * Checks an issue against the suppression file and the baseline (see IssueFilter).
+	 * Lets callers skip expensive work for issues that would be filtered anyway.
+	 */
+	bool ShouldReportIssue(const FValidatorXIssue& Issue) const;
+
+	/**
+	 * Filters the issue, records it in the issue log and the report of the run and, when messages are displayed,
+	 * formats it into the context.
+	 *
+	 * @return False when the issue was filtered out
+	 */
+	bool ReportIssue(FDataValidationContext& Context, const FValidatorXIssue& Issue);
+
+private:
+	/**
+	 * Writes bIsEnabled of this validator class to the editor config, deferred while FValidatorXConfigManager batches
+	 * toggles.
+	 */
+	void SaveEnabledConfig(bool bEnabled) const;
+
+	/** Set once the single summary message of a run without message formatting has been added */
+	bool bAddedDeferredSummary = false;
+};
\ No newline at end of file
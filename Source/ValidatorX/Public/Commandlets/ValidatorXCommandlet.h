@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ValidatorXCommandlet.generated.h"
+
+struct FAssetData;
+class UBlueprint;
+
+/**
+ * Project-wide ValidatorX analyses for CI and batch runs.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=ValidatorX -Mode=<Mode> [-Path=/Game] [options]
+ *
+ * Modes:
+ *   Similarity   MinHash/LSH clustering of near-duplicate Blueprints.
+ *                -Threshold=0.8 -Bands=16 -Rows=4 -MinShingles=20 -Output=<csv> [-FromSnapshot]
+ *   Snapshot     Writes the graph topology of every Blueprint into binary shards (see BlueprintSnapshot).
+ *                -BatchSize=500 -SnapshotDir=<dir>
+ *   CompileProfile  Compiles every Blueprint with timing and appends the results to the compile history.
+ *                -Budget=250 [-FailOverBudget]
+ *   Validate     Runs the ValidatorX validators on every Blueprint and streams the issues into a SARIF or JSON lines report.
+ *                -Report=<file.sarif|file.jsonl> -Validators=<Name,...> -Preset=<SaveTimeFast|CIFull|PerfAudit> [-FailOnIssues]
+ *                -Changed=<git revision range> only validates the packages changed in the range and their direct
+ *                referencers and dependencies; -Git=<path> when git is not on the PATH
+ *   Merge        Combines shard reports into one, dropping issues with the same fingerprint.
+ *                -Inputs=<dir or wildcard> -Output=<file> [-FailOnIssues]
+ *   Launch       Runs Validate in -Shards=N child processes on this machine, then merges their reports.
+ *                -Shards=<N> -Output=<file>, other options are passed to the shards. Shards run with
+ *                -ValidatorXNoPersist so they do not race on Saved/ValidatorX; -ValidatorXWriteBaseline is
+ *                written per shard and merged by the launching process
+ *
+ * Every mode that gathers Blueprints accepts -Shard=i/N (0 <= i < N) and then only handles the packages whose
+ * stable name hash falls into shard i, so N processes or machines split a project without coordination.
+ * Validate writes shard reports next to the report, e.g. ValidatorX.shard2of8.jsonl.
+ *
+ * Modes that load Blueprints keep -LoadAhead=8 packages loading asynchronously while the current one is processed
+ * (0 loads synchronously) and stop requesting more while the process uses over -MemoryCeilingMB (default half of
+ * the physical memory), collecting garbage until it is back under.
+ *
+ * Modes that read snapshots (-FromSnapshot) never load packages and use -SnapshotDir (default Saved/ValidatorX/Snapshots).
+ */
+UCLASS()
+class VALIDATORX_API UValidatorXCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UValidatorXCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunSimilarity(const TMap<FString, FString>& Options, const TArray<FString>& Switches);
+	int32 RunSnapshot(const TMap<FString, FString>& Options);
+	int32 RunCompileProfile(const TMap<FString, FString>& Options, const TArray<FString>& Switches);
+	int32 RunValidate(const TMap<FString, FString>& Options, const TArray<FString>& Switches);
+	int32 RunMerge(const TMap<FString, FString>& Options, const TArray<FString>& Switches);
+	int32 RunLaunch(const FString& Params, const TMap<FString, FString>& Options, const TArray<FString>& Switches);
+
+	/** Merges the given reports into OutputPath; returns the number of error and warning issues, INDEX_NONE on failure */
+	int32 MergeReports(const TArray<FString>& InputPaths, const FString& OutputPath) const;
+
+	/** Finds every Blueprint asset under -Path (default /Game) from a fully scanned asset registry, restricted to -Shard */
+	void GatherBlueprintAssets(const TMap<FString, FString>& Options, TArray<FAssetData>& OutAssets) const;
+
+	/**
+	 * Keeps the assets changed in the -Changed git range and their direct referencers and dependencies: referencers
+	 * may break with the change, dependencies may lose their last user (unused functions, dispatchers...). Referencers
+	 * of deleted packages and of the old names of renamed ones are kept too, their references now dangle.
+	 *
+	 * @return False when git failed; the caller must not fall back to validating less than asked
+	 */
+	bool FilterChangedAssets(const TMap<FString, FString>& Options, TArray<FAssetData>& InOutAssets) const;
+
+	/**
+	 * Package names of the .uasset and .umap files git reports in Range.
+	 *
+	 * @param OutPackages         Added, copied and modified files, and the new names of renamed ones
+	 * @param OutRemovedPackages  Deleted files and the old names of renamed ones
+	 */
+	static bool GetChangedPackages(const FString& Range, const FString& GitPath, TSet<FName>& OutPackages, TSet<FName>& OutRemovedPackages);
+
+	/**
+	 * Calls Visitor on each Blueprint in order while the next LoadAhead packages load asynchronously, so I/O
+	 * overlaps with the work on the current one. Prefetched assets are pinned until visited. Garbage is collected
+	 * every GCInterval assets, and after every asset while memory is over MemoryCeiling; no new loads are requested
+	 * then, so at most LoadAhead assets are held on top of the one being validated.
+	 * Stops between assets once an engine exit is requested (Ctrl+C), waiting for the loads in flight first.
+	 *
+	 * @return False when cancelled before every asset was visited
+	 */
+	bool ForEachLoadedBlueprint(const TArray<FAssetData>& Assets, TFunctionRef<void(int32 AssetIndex, UBlueprint* Blueprint)> Visitor) const;
+
+	/** Default output location for commandlet reports */
+	static FString GetReportPath(const TMap<FString, FString>& Options, const TCHAR* DefaultFileName);
+
+	/** Parses -Shard=i/N; false without one or when it is malformed */
+	static bool ParseShard(const TMap<FString, FString>& Options, int32& OutShardIndex, int32& OutNumShards);
+
+	/** Report file of one shard: <Path>.shard<i>of<N>.<ext> */
+	static FString GetShardReportPath(const FString& ReportPath, int32 ShardIndex, int32 NumShards);
+
+	/** Directory holding snapshot shards */
+	static FString GetSnapshotDir(const TMap<FString, FString>& Options);
+
+	static constexpr int32 GCInterval = 200;
+
+	/** Time given to the loads in flight after each visited asset, in seconds */
+	static constexpr float LoadTimeSlice = 0.005f;
+
+	/** Packages requested ahead of the one being visited, -LoadAhead */
+	int32 LoadAhead = 8;
+
+	/** Used physical memory over which no loads are requested and garbage is collected after each asset, -MemoryCeilingMB */
+	uint64 MemoryCeiling = 0;
+};
@@ -0,0 +1,116 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Columns of the project health table. Name and Folder sort by precomputed rank, the others are int32 metrics. */
+enum class EValidatorXHealthColumn : uint8
+{
+	Name,
+	Folder,
+	Nodes,
+	Graphs,
+	MaxGraphNodes,
+	MacroInstances,
+	TickingEvents,
+	TickCost,
+	HardReferences,
+	Issues,
+	Num
+};
+
+/**
+ * Per-Blueprint metrics and issue counts of the whole project, stored column by column so that 50k rows sort and
+ * filter without touching a UObject. Metrics come from the ValidatorX registry tags (see BlueprintAssetTags); issue
+ * counts (warnings and errors, not info notes) of packages validated in this session come from the issue log, the
+ * others from the tags of the last save.
+ * Unknown values (assets saved before ValidatorX was installed) are INDEX_NONE and sort first.
+ */
+class VALIDATORX_API FValidatorXHealthTable
+{
+public:
+	static constexpr int32 FirstMetric = static_cast<int32>(EValidatorXHealthColumn::Nodes);
+	static constexpr int32 NumMetrics = static_cast<int32>(EValidatorXHealthColumn::Num) - FirstMetric;
+
+	/** Aggregate of a folder or a validator */
+	struct FGroup
+	{
+		FName Key;
+		int32 NumAssets = 0;
+
+		/** Sums over the assets of the group, maxima for MaxGraphNodes */
+		int32 Values[NumMetrics] = {};
+	};
+
+	/** Gathers every Blueprint under Path from the asset registry; nothing is loaded */
+	void Build(const FString& Path);
+
+	/** Re-reads the issue counts of the packages validated since the last build */
+	void UpdateIssues();
+
+	int32 Num() const { return PackageNames.Num(); }
+
+	/** Blueprint classes whose default object can ever tick according to their tags, counted over the whole table */
+	int32 NumTicking() const { return NumTickingAssets; }
+
+	FName GetPackageName(int32 Row) const { return PackageNames[Row]; }
+	FName GetAssetName(int32 Row) const { return AssetNames[Row]; }
+	FName GetFolder(int32 Row) const { return Folders[Row]; }
+	int32 GetValue(int32 Row, EValidatorXHealthColumn Column) const { return Metrics[MetricIndex(Column)][Row]; }
+
+	/** Validators with issues in this session, indexed by GetValidatorIndex */
+	const TArray<FName>& GetValidatorNames() const { return ValidatorNames; }
+	int32 GetValidatorIndex(FName ValidatorName) const { return ValidatorNames.IndexOfByKey(ValidatorName); }
+
+	/**
+	 * Rows matching a filter, sorted.
+	 *
+	 * @param Filter           Case-insensitive substring of the package path, empty for all
+	 * @param ValidatorIndex   Only rows with issues from this validator, INDEX_NONE for all
+	 * @param PreviousRows     Result of a query whose filter is contained in Filter, narrowed instead of scanning every row; may be null
+	 * @param OutRows          Matching row indices
+	 */
+	void Query(const FString& Filter, int32 ValidatorIndex, const TArray<int32>* PreviousRows, TArray<int32>& OutRows) const;
+
+	void SortRows(TArray<int32>& Rows, EValidatorXHealthColumn Column, bool bDescending) const;
+
+	/** Aggregates rows by folder */
+	void GroupByFolder(const TArray<int32>& Rows, TArray<FGroup>& OutGroups) const;
+
+	/** Aggregates rows by the validators that reported issues on them; Issues holds the issues of that validator only */
+	void GroupByValidator(const TArray<int32>& Rows, TArray<FGroup>& OutGroups) const;
+
+	static void SortGroups(TArray<FGroup>& Groups, EValidatorXHealthColumn Column, bool bDescending);
+
+	static FText GetColumnLabel(EValidatorXHealthColumn Column);
+
+private:
+	static int32 MetricIndex(EValidatorXHealthColumn Column) { return static_cast<int32>(Column) - FirstMetric; }
+
+	TArray<FName> PackageNames;
+	TArray<FName> AssetNames;
+	TArray<FName> Folders;
+
+	/** Lower case package paths, searched by Query */
+	TArray<FString> SearchPaths;
+
+	/** Lexical order of PackageNames and Folders, so sorting compares integers */
+	TArray<int32> NameRanks;
+	TArray<int32> FolderRanks;
+
+	TArray<int32> Metrics[NumMetrics];
+
+	TMap<FName, int32> RowByPackage;
+	int32 NumTickingAssets = 0;
+
+	/** Issues per (row, validator) from the issue log, sorted by row */
+	struct FValidatorIssues
+	{
+		int32 Row = 0;
+		int32 ValidatorIndex = 0;
+		int32 NumIssues = 0;
+	};
+	TArray<FValidatorIssues> ValidatorIssues;
+	TArray<FName> ValidatorNames;
+};
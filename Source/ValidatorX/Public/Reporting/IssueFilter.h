@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace ValidatorX
+{
+	/**
+	 * Stable fingerprint of an issue, identical across runs and machines as long as the issue stays put.
+	 *
+	 * @param ValidatorClass    Class of the validator emitting the issue
+	 * @param PackageName       Long package name of the asset
+	 * @param Locator           Node GUID and/or member name the issue is attached to (see FValidatorXIssue::GetLocator), empty for asset-wide issues
+	 * @param RuleKey           Validator specific rule, lets one validator emit several issues on the same node
+	 */
+	VALIDATORX_API uint64 MakeIssueFingerprint(const UClass* ValidatorClass, FName PackageName, const FString& Locator, FName RuleKey);
+}
+
+/**
+ * Decides which issues are reported, before any message text is built.
+ *
+ * Suppressions are read from Config/ValidatorXSuppressions.txt and always apply. A baseline of known issues
+ * is read from the file given with -ValidatorXBaseline=<file>; when one is loaded only issues missing from it
+ * are reported, which lets CI fail on new issues only. -ValidatorXWriteBaseline=<file> records every issue
+ * seen during the run (suppressed or not) and writes a fresh baseline on shutdown.
+ *
+ * Files hold one 16 digit hex fingerprint per line; anything after '#' is a comment.
+ */
+class VALIDATORX_API FValidatorXIssueFilter
+{
+	FValidatorXIssueFilter() {}
+	FValidatorXIssueFilter(const FValidatorXIssueFilter&) = delete;
+	FValidatorXIssueFilter& operator=(const FValidatorXIssueFilter&) = delete;
+
+public:
+	static FValidatorXIssueFilter& Get()
+	{
+		static FValidatorXIssueFilter Instance;
+		return Instance;
+	}
+
+	/** Loads the suppression file and the baseline named on the command line */
+	void Initialize();
+
+	/**
+	 * Records the issue for baseline writing and tells whether it should be reported.
+	 *
+	 * @param Fingerprint   See ValidatorX::MakeIssueFingerprint
+	 * @param Description   Builds the human readable comment written next to the fingerprint, only called when recording
+	 * @return False for suppressed issues and issues in the baseline
+	 */
+	bool ShouldReport(uint64 Fingerprint, TFunctionRef<FString()> Description);
+
+	bool HasBaseline() const { return bHasBaseline; }
+
+	/** Number of issues filtered out since startup */
+	int32 GetNumFiltered() const { return NumFiltered; }
+
+	/** Adds the issues of a baseline written by another process, e.g. a shard, to those written by WriteBaseline */
+	bool AddRecordedIssues(const FString& FilePath);
+
+	/** Writes every recorded fingerprint to the -ValidatorXWriteBaseline file, if one was requested */
+	void WriteBaseline() const;
+
+	static bool LoadFingerprints(const FString& FilePath, TSet<uint64>& OutFingerprints);
+
+private:
+	TSet<uint64> Suppressions;
+	TSet<uint64> Baseline;
+	bool bHasBaseline = false;
+
+	FString WriteBaselinePath;
+	TMap<uint64, FString> RecordedIssues;
+
+	int32 NumFiltered = 0;
+};
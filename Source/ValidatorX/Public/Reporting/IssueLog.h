@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Reporting/IssueTable.h"
+#include "Reporting/ValidationIssue.h"
+
+/**
+ * Keeps the structured issue records of the latest validation of every asset, stored in an FValidatorXIssueTable
+ * the Issues panel of the ValidatorX tab reads directly.
+ *
+ * In the interactive editor issues are formatted into the Message Log as they are reported. In commandlets and
+ * unattended runs nobody reads the log, so only the records are kept and formatting is skipped entirely unless
+ * -ValidatorXFormatMessages is given; ShowInMessageLog formats them on demand. Past -ValidatorXMaxMessages=
+ * (default 2000) issues the editor stops formatting too and leaves the rest to the Issues panel of the ValidatorX tab.
+ */
+class VALIDATORX_API FValidatorXIssueLog
+{
+	FValidatorXIssueLog() {}
+	FValidatorXIssueLog(const FValidatorXIssueLog&) = delete;
+	FValidatorXIssueLog& operator=(const FValidatorXIssueLog&) = delete;
+
+public:
+	static FValidatorXIssueLog& Get()
+	{
+		static FValidatorXIssueLog Instance;
+		return Instance;
+	}
+
+	/** True when reported issues are turned into messages right away, false once the message cap is reached */
+	bool IsFormattingMessages() const;
+
+	/** Records issues without formatting messages while alive, for validations nobody displays */
+	struct FSuspendFormattingScope
+	{
+		FSuspendFormattingScope() { Get().NumFormattingSuspensions++; }
+		~FSuspendFormattingScope() { Get().NumFormattingSuspensions--; }
+	};
+
+	/** Drops the records a validator produced for a package, called when the package is validated again */
+	void BeginAsset(const UClass* Validator, FName PackageName);
+
+	void Add(const FValidatorXIssue& Issue);
+
+	/** True once any validator began validating the package in this session */
+	bool WasValidated(FName PackageName) const { return ValidatedPackages.Contains(PackageName); }
+
+	/**
+	 * Combined fingerprint of the warnings and errors of the latest validation of a package, independent of their order.
+	 *
+	 * @param OutNumIssues  Number of warnings and errors
+	 * @return 0 when the package has no warnings or errors
+	 */
+	uint64 GetPackageFingerprint(FName PackageName, int32& OutNumIssues) const;
+
+	int32 Num() const { return Table.Num(); }
+
+	void ForEachIssue(TFunctionRef<void(const FValidatorXIssue&)> Callback) const { Table.ForEachIssue(Callback); }
+
+	const FValidatorXIssueTable& GetTable() const { return Table; }
+
+	/** Formats every record into the named message log and opens it */
+	void ShowInMessageLog(FName LogName) const;
+
+	/** Builds the message of a record through its validator */
+	static TSharedRef<FTokenizedMessage> MakeMessage(const FValidatorXIssue& Issue);
+
+	void Reset();
+
+private:
+	FValidatorXIssueTable Table;
+
+	TSet<FName> ValidatedPackages;
+
+	mutable TOptional<bool> bFormatMessages;
+	mutable bool bForceFormatMessages = false;
+	mutable int32 MaxFormattedMessages = 2000;
+	int32 NumFormattingSuspensions = 0;
+};
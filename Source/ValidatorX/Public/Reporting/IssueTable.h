@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Reporting/ValidationIssue.h"
+
+/**
+ * Issue records of the issue log, stored column by column. Names are FNames, validators, severities and folders small
+ * indices and arguments one shared pool, so a row costs a few dozen bytes instead of a record with its own argument
+ * array. Messages are only formatted for the rows on screen.
+ *
+ * Rows of a revalidated asset are only marked removed, so row indices stay valid for the issue browser; once most rows
+ * are removed the table is compacted and GetLayoutVersion changes.
+ */
+class VALIDATORX_API FValidatorXIssueTable
+{
+public:
+	/** Bits of the severity facet, indexed by EMessageSeverity::Type */
+	static constexpr int32 NumSeverities = 8;
+
+	/** Severity, validator and folder facets; a facet value is skipped when its bit is cleared */
+	struct FFacets
+	{
+		TBitArray<> Severities;
+		TBitArray<> Validators;
+		TBitArray<> Folders;
+	};
+
+	FValidatorXIssueTable();
+
+	void Add(const FValidatorXIssue& Issue);
+
+	/**
+	 * Marks the rows a validator reported for a package removed.
+	 *
+	 * @return Number of removed rows
+	 */
+	int32 RemoveAsset(const UClass* Validator, FName PackageName);
+
+	void Reset();
+
+	/** Rows that are not removed */
+	int32 Num() const { return Severities.Num() - NumRemovedRows; }
+
+	/** Rows including the removed ones, the bound of row indices */
+	int32 NumRows() const { return Severities.Num(); }
+
+	bool IsRowRemoved(int32 Row) const { return RemovedRows[Row]; }
+
+	/** Changes whenever rows move to other indices */
+	uint32 GetLayoutVersion() const { return LayoutVersion; }
+
+	/** Rebuilds the record of a row, for formatting and jumps */
+	FValidatorXIssue GetIssue(int32 Row) const;
+
+	/** Records of the rows that are not removed, in the order they were added */
+	void ForEachIssue(TFunctionRef<void(const FValidatorXIssue&)> Callback) const;
+
+	/** Rows of a package that are not removed */
+	void ForEachPackageRow(FName PackageName, TFunctionRef<void(int32)> Callback) const;
+
+	EMessageSeverity::Type GetSeverity(int32 Row) const { return static_cast<EMessageSeverity::Type>(Severities[Row]); }
+	const UClass* GetValidator(int32 Row) const { return ValidatorClasses[ValidatorIndices[Row]]; }
+	FName GetRuleId(int32 Row) const { return RuleIds[Row]; }
+	FName GetPackageName(int32 Row) const { return PackageNames[Row]; }
+	FName GetGraphName(int32 Row) const { return GraphNames[Row]; }
+	FName GetMemberName(int32 Row) const { return MemberNames[Row]; }
+	uint64 GetFingerprint(int32 Row) const { return Fingerprints[Row]; }
+
+	/** Facet values, indexed like the bits of FFacets */
+	const TArray<const UClass*>& GetValidatorClasses() const { return ValidatorClasses; }
+	const TArray<FName>& GetFolders() const { return Folders; }
+
+	/** Facets with every value enabled */
+	FFacets MakeAllFacets() const;
+
+	/**
+	 * Rows matching a search, in log order. Each distinct name is matched once, rows only compare name indices.
+	 *
+	 * @param SearchText     Case-insensitive substring of the package, graph, member or rule, empty for all
+	 * @param PreviousRows   Result of a search contained in SearchText, narrowed instead of scanning every row; may be null
+	 * @param OutRows        Matching rows
+	 */
+	void Search(const FString& SearchText, const TArray<int32>* PreviousRows, TArray<int32>& OutRows) const;
+
+	/** Keeps the rows whose severity, validator and folder are enabled */
+	void ApplyFacets(const TArray<int32>& Rows, const FFacets& Facets, TArray<int32>& OutRows) const;
+
+	/** Number of rows per facet value among Rows */
+	void CountFacets(const TArray<int32>& Rows, TArray<int32>& OutSeverities, TArray<int32>& OutValidators, TArray<int32>& OutFolders) const;
+
+	/** Bytes held by the columns and their indices, shown next to the row count */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Drops the removed rows from every column */
+	void Compact();
+
+	int32 FindOrAddValidator(const UClass* Validator);
+	int32 FindOrAddFolder(FName PackageName);
+
+	TArray<uint8> Severities;
+	TArray<uint16> ValidatorIndices;
+	TArray<int32> FolderIndices;
+	TArray<FName> RuleIds;
+	TArray<FName> PackageNames;
+	TArray<FName> AssetNames;
+	TArray<FName> GraphNames;
+	TArray<FName> MemberNames;
+	TArray<FGuid> NodeGuids;
+	TArray<uint64> Fingerprints;
+
+	/** Arguments of row i are ArgPool[ArgOffsets[i]] .. ArgPool[ArgOffsets[i + 1]] */
+	TArray<int32> ArgOffsets;
+	TArray<FValidatorXIssueArg> ArgPool;
+
+	TBitArray<> RemovedRows;
+	int32 NumRemovedRows = 0;
+	uint32 LayoutVersion = 0;
+
+	/** Rows per package, including removed ones until the next compaction */
+	TMap<FName, TArray<int32>> RowsByPackage;
+
+	TArray<const UClass*> ValidatorClasses;
+	TMap<const UClass*, int32> ValidatorIndexByClass;
+	TArray<FName> Folders;
+	TMap<FName, int32> FolderIndexByName;
+};
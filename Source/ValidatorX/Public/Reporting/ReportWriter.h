@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Reporting/ValidationIssue.h"
+
+class FArchive;
+
+enum class EValidatorXReportFormat : uint8
+{
+	/** SARIF 2.1.0, understood by most CI code scanning tools */
+	Sarif,
+
+	/** One JSON object per line, easy to grep and to stream into other tools */
+	JsonLines
+};
+
+/** One issue as written to a report; also what ReadReport returns */
+struct VALIDATORX_API FValidatorXReportRecord
+{
+	/** Rule qualified by its validator, e.g. UnusedNodeValidator/UnusedNode */
+	FString RuleId;
+
+	/** error, warning or note */
+	FString Level;
+
+	FString PackageName;
+	FString AssetPath;
+	FString GraphName;
+	FString NodeGuid;
+	FString MemberName;
+	uint64 Fingerprint = 0;
+	bool bHasFix = false;
+
+	/** Raw message arguments of the issue, what the validator formats its message from */
+	TArray<FString> Arguments;
+
+	/** Formatted message when the run formats messages, the rule id otherwise */
+	FString Message;
+};
+
+/** Time one validator took during the run of a report */
+struct VALIDATORX_API FValidatorXReportTiming
+{
+	FString Validator;
+	int32 NumAssets = 0;
+	int32 NumIssues = 0;
+	double Seconds = 0.0;
+};
+
+/**
+ * Streams issues into a SARIF or JSON lines report as they are reported, so memory stays flat however many
+ * issues a run finds. Close ends the report with the time every validator took.
+ *
+ * The report of a run is opened with -ValidatorXReport=<file> [-ValidatorXReportFormat=Sarif|JsonLines], in the
+ * editor as well as in commandlets; the format defaults to JSON lines for .jsonl files and SARIF otherwise.
+ * Issues carry their rule and raw arguments; message text is only formatted where the issue log would format it,
+ * the interactive editor or -ValidatorXFormatMessages, so CI runs never build it.
+ */
+class VALIDATORX_API FValidatorXReportWriter
+{
+public:
+	FValidatorXReportWriter() {}
+	~FValidatorXReportWriter();
+
+	FValidatorXReportWriter(const FValidatorXReportWriter&) = delete;
+	FValidatorXReportWriter& operator=(const FValidatorXReportWriter&) = delete;
+
+	/** Report of this run, fed by every reported issue while it is open */
+	static FValidatorXReportWriter& Get()
+	{
+		static FValidatorXReportWriter Instance;
+		return Instance;
+	}
+
+	/** Opens the report of this run when -ValidatorXReport is given */
+	void InitializeFromCommandLine();
+
+	bool Open(const FString& InPath, EValidatorXReportFormat InFormat);
+	bool IsOpen() const { return Writer.IsValid(); }
+
+	void WriteIssue(const FValidatorXIssue& Issue);
+	void WriteRecord(const FValidatorXReportRecord& Record);
+
+	/** Replaces the timing summary, which defaults to FValidatorXValidatorStats; used when merging reports */
+	void SetTimings(TArray<FValidatorXReportTiming> InTimings) { Timings = MoveTemp(InTimings); }
+
+	/** Writes the per-validator timing summary and the end of the report */
+	void Close();
+
+	int32 GetNumIssues() const { return NumIssues; }
+
+	const FString& GetPath() const { return Path; }
+
+	static EValidatorXReportFormat GetFormatForPath(const FString& InPath);
+
+	/** Writes the issues currently in the issue log into a new report, used to export from the editor */
+	static bool WriteIssueLog(const FString& InPath);
+
+	/**
+	 * Reads a report written by this class, in either format.
+	 *
+	 * @param InPath      SARIF or JSON lines report
+	 * @param OnRecord    Called for every issue, in file order
+	 * @param OutTimings  Timing summary of the report
+	 * @return False when the file could not be read or parsed
+	 */
+	static bool ReadReport(const FString& InPath, TFunctionRef<void(const FValidatorXReportRecord&)> OnRecord, TArray<FValidatorXReportTiming>& OutTimings);
+
+private:
+	void WriteString(const FString& String);
+
+	TUniquePtr<FArchive> Writer;
+	FString Path;
+	EValidatorXReportFormat Format = EValidatorXReportFormat::Sarif;
+	int32 NumIssues = 0;
+	double StartTime = 0.0;
+
+	/** Message text of issues is formatted, see the class comment */
+	bool bFormatMessages = false;
+
+	/** SARIF lists the rules of a run once, after the results */
+	TSet<FString> RuleIds;
+
+	/** Project relative package file of every package in a SARIF report, looked up once per package */
+	TMap<FString, FString> ArtifactUris;
+
+	TOptional<TArray<FValidatorXReportTiming>> Timings;
+};
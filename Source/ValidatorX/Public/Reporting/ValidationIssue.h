@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Logging/TokenizedMessage.h"
+#include "Misc/TVariant.h"
+
+class UBlueprint;
+class UEdGraph;
+
+/** Argument of an issue message, kept raw until the message is displayed */
+struct VALIDATORX_API FValidatorXIssueArg
+{
+	/** Size in bytes, displayed as memory */
+	struct FBytes
+	{
+		int64 Value = 0;
+	};
+
+	FValidatorXIssueArg(int32 InValue) : Value(TInPlaceType<int64>(), InValue) {}
+	FValidatorXIssueArg(int64 InValue) : Value(TInPlaceType<int64>(), InValue) {}
+	FValidatorXIssueArg(float InValue) : Value(TInPlaceType<double>(), InValue) {}
+	FValidatorXIssueArg(double InValue) : Value(TInPlaceType<double>(), InValue) {}
+	FValidatorXIssueArg(FName InValue) : Value(TInPlaceType<FName>(), InValue) {}
+	FValidatorXIssueArg(FString&& InValue) : Value(TInPlaceType<FString>(), MoveTemp(InValue)) {}
+	FValidatorXIssueArg(FBytes InValue) : Value(TInPlaceType<FBytes>(), InValue) {}
+	FValidatorXIssueArg(const FGuid& InValue) : Value(TInPlaceType<FGuid>(), InValue) {}
+
+	static FValidatorXIssueArg Bytes(int64 InBytes) { return FBytes{ InBytes }; }
+
+	FFormatArgumentValue ToFormatArgument() const;
+	FString ToString() const;
+
+	TVariant<int64, double, FName, FString, FBytes, FGuid> Value;
+};
+
+/**
+ * Compact record of one finding. Validators fill it with raw values only; the message text and its
+ * action tokens are built by the validator's FormatIssue/AddIssueTokens when the issue is displayed.
+ */
+struct VALIDATORX_API FValidatorXIssue
+{
+	/** Validator specific rule, also part of the fingerprint */
+	FName RuleId;
+	EMessageSeverity::Type Severity = EMessageSeverity::Warning;
+
+	/** Class of the reporting validator, formats the message */
+	const UClass* Validator = nullptr;
+
+	FName PackageName;
+	FName AssetName;
+	FName GraphName;
+
+	/** Variable, function, dispatcher or pin the issue is about, if any */
+	FName MemberName;
+	FGuid NodeGuid;
+
+	/** Node while it is still loaded, avoids searching the graphs by GUID */
+	TWeakObjectPtr<UEdGraphNode> Node;
+
+	/** See ValidatorX::MakeIssueFingerprint */
+	uint64 Fingerprint = 0;
+
+	TArray<FValidatorXIssueArg, TInlineAllocator<4>> Args;
+
+	FValidatorXIssue& Add(FValidatorXIssueArg&& Arg)
+	{
+		Args.Add(MoveTemp(Arg));
+		return *this;
+	}
+
+	FFormatArgumentValue GetArg(int32 Index) const
+	{
+		return Args.IsValidIndex(Index) ? Args[Index].ToFormatArgument() : FFormatArgumentValue(FText::GetEmpty());
+	}
+
+	int64 GetNumberArg(int32 Index) const
+	{
+		return Args.IsValidIndex(Index) && Args[Index].Value.IsType<int64>() ? Args[Index].Value.Get<int64>() : 0;
+	}
+
+	/** GUID of another node the issue refers to, invalid if the argument is not a GUID */
+	FGuid GetGuidArg(int32 Index) const
+	{
+		return Args.IsValidIndex(Index) && Args[Index].Value.IsType<FGuid>() ? Args[Index].Value.Get<FGuid>() : FGuid();
+	}
+
+	/** Warnings and errors; info notes are kept in the log but do not count as issues of the asset */
+	bool IsProblem() const { return Severity <= EMessageSeverity::Warning; }
+
+	FText GetAssetText() const { return FText::FromName(AssetName); }
+	FText GetGraphText() const { return FText::FromName(GraphName); }
+	FText GetMemberText() const { return FText::FromName(MemberName); }
+
+	/** Object path of the asset, e.g. /Game/Characters/BP_Hero.BP_Hero */
+	FString GetAssetPath() const;
+
+	/** Locator used by the fingerprint: node GUID or graph name, followed by the member name */
+	FString GetLocator() const;
+
+	/** Asset if it is loaded, never loads it */
+	UObject* FindAsset() const;
+
+	/** Asset, loading it when needed; used by action tokens */
+	UObject* LoadAsset() const;
+
+	UEdGraphNode* FindNode() const;
+	UEdGraph* FindGraph() const;
+
+	/** Title of the node, or its GUID once the asset is unloaded */
+	FText GetNodeTitle(ENodeTitleType::Type TitleType = ENodeTitleType::ListView) const;
+};
+
+namespace ValidatorX
+{
+	/** Opens the asset editor and focuses the issue's node, graph or member, whichever is known */
+	VALIDATORX_API void JumpToIssue(const FValidatorXIssue& Issue);
+
+	/** Jump token with the repo's usual label for the kind of location */
+	VALIDATORX_API TSharedRef<IMessageToken> MakeJumpToIssueToken(const FValidatorXIssue& Issue);
+
+	/**
+	 * Fix token: opens the asset editor, asks for confirmation and runs the fix on the Blueprint.
+	 * The Blueprint is loaded when the token is clicked, so the fix must find its target from the record.
+	 */
+	VALIDATORX_API TSharedRef<IMessageToken> MakeFixIssueToken(const FValidatorXIssue& Issue, const FText& FixText, const FText& ConfirmText, TFunction<void(UBlueprint*)> Fix);
+}
@@ -0,0 +1,30 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Assets done, node throughput and remaining time of a batch validation, for slow tasks and commandlet logs */
+class VALIDATORX_API FValidatorXValidationProgress
+{
+public:
+	explicit FValidatorXValidationProgress(int32 InNumAssets);
+
+	/** Records a validated asset and its node count */
+	void AddAsset(int32 NumAssetNodes);
+
+	int32 GetNumDone() const { return NumDone; }
+	int32 GetNumAssets() const { return NumAssets; }
+
+	/** Estimated seconds left from the average time per asset so far, 0 before the first asset */
+	double GetSecondsLeft() const;
+
+	/** e.g. "120 / 4000 Blueprints, 3500 nodes/s, 00:02:10 left" */
+	FText GetText() const;
+
+private:
+	int32 NumAssets = 0;
+	int32 NumDone = 0;
+	int64 NumNodes = 0;
+	double StartTime = 0.0;
+};
@@ -0,0 +1,93 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Sort.h"
+#include "UObject/Class.h"
+
+class UBlueprintValidatorBase;
+
+/**
+ * Average cost and hit rate (share of validated assets with at least one issue) of every validator across sessions,
+ * persisted to Saved/ValidatorX/ValidatorSchedule.csv.
+ *
+ * ValidatorX's own editor runs execute validators by decreasing priority, hit rate over average cost, so cheap
+ * validators likely to find something come first. With fail-fast on, expensive validators (IsExpensive, or slower
+ * than ExpensiveMs per asset on average) are skipped on assets that already have errors; commandlets always run
+ * everything.
+ */
+class VALIDATORX_API FValidatorXValidatorSchedule
+{
+	FValidatorXValidatorSchedule() {}
+	FValidatorXValidatorSchedule(const FValidatorXValidatorSchedule&) = delete;
+	FValidatorXValidatorSchedule& operator=(const FValidatorXValidatorSchedule&) = delete;
+
+public:
+	struct FEntry
+	{
+		int32 NumAssets = 0;
+		int32 NumHits = 0;
+		double Seconds = 0.0;
+
+		double GetAverageMs() const { return NumAssets > 0 ? Seconds * 1000.0 / NumAssets : 0.0; }
+		float GetHitRate() const { return NumAssets > 0 ? static_cast<float>(NumHits) / NumAssets : 0.0f; }
+	};
+
+	static FValidatorXValidatorSchedule& Get()
+	{
+		static FValidatorXValidatorSchedule Instance;
+		return Instance;
+	}
+
+	/** Records one validation of an asset; bHit when it reported an issue */
+	void AddValidation(const UClass* Validator, double Seconds, bool bHit);
+
+	/** Measurements of a validator class, null before its first validation */
+	const FEntry* Find(const UClass* Validator) const;
+
+	/**
+	 * Smoothed hit rate per smoothed millisecond, so a validator with few samples neither jumps to the front nor
+	 * sinks to the back.
+	 */
+	double GetPriority(const UClass* Validator) const;
+
+	/** Declared expensive by the validator, or measured over ExpensiveMs per asset */
+	bool IsExpensive(const UBlueprintValidatorBase* Validator) const;
+
+	/** Orders validators, given as instances or classes, by decreasing priority and by class name on ties */
+	template<typename ValidatorPtrType>
+	void SortValidators(TArray<ValidatorPtrType>& Validators) const
+	{
+		Algo::Sort(Validators, [this] (const ValidatorPtrType& A, const ValidatorPtrType& B)
+			{
+				const UClass* ClassA = GetValidatorClass(&*A);
+				const UClass* ClassB = GetValidatorClass(&*B);
+				const double PriorityA = GetPriority(ClassA);
+				const double PriorityB = GetPriority(ClassB);
+				return PriorityA != PriorityB ? PriorityA > PriorityB : ClassA->GetFName().LexicalLess(ClassB->GetFName());
+			});
+	}
+
+	bool IsFailFastEnabled() const { return bFailFast; }
+	void SetFailFastEnabled(bool bEnabled) { bFailFast = bEnabled; }
+
+	/** Loads the measurements from Saved/ValidatorX and reads -ValidatorXFailFast */
+	void Load();
+
+	/** Writes the measurements if they changed since the last Load/Save */
+	void Save();
+
+	/** Average cost over which a validator counts as expensive */
+	static constexpr double ExpensiveMs = 5.0;
+
+private:
+	static const UClass* GetValidatorClass(const UClass* Validator) { return Validator; }
+	static const UClass* GetValidatorClass(const UObject* Validator) { return Validator->GetClass(); }
+
+	static FString GetFilePath();
+
+	TMap<FName, FEntry> Entries;
+	bool bDirty = false;
+	bool bFailFast = false;
+};
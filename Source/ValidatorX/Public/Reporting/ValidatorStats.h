@@ -0,0 +1,81 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Validation time and issue count of every validator during this session, summarised at the end of reports */
+class VALIDATORX_API FValidatorXValidatorStats
+{
+	FValidatorXValidatorStats() {}
+	FValidatorXValidatorStats(const FValidatorXValidatorStats&) = delete;
+	FValidatorXValidatorStats& operator=(const FValidatorXValidatorStats&) = delete;
+
+public:
+	struct FEntry
+	{
+		int32 NumAssets = 0;
+		int32 NumIssues = 0;
+
+		/** Warnings and errors among NumIssues */
+		int32 NumProblems = 0;
+		double Seconds = 0.0;
+	};
+
+	static FValidatorXValidatorStats& Get()
+	{
+		static FValidatorXValidatorStats Instance;
+		return Instance;
+	}
+
+	/** Also feeds the persistent validator schedule; bHit when the validation reported a warning or an error */
+	void AddValidation(const UClass* Validator, double Seconds, bool bHit);
+	void AddIssue(const UClass* Validator, bool bIsProblem);
+
+	int32 GetNumIssues(const UClass* Validator) const
+	{
+		const FEntry* Entry = Entries.Find(Validator);
+		return Entry ? Entry->NumIssues : 0;
+	}
+
+	int32 GetNumProblems(const UClass* Validator) const
+	{
+		const FEntry* Entry = Entries.Find(Validator);
+		return Entry ? Entry->NumProblems : 0;
+	}
+
+	/** Entries sorted by total time, slowest first */
+	TArray<TPair<const UClass*, FEntry>> GetSortedEntries() const;
+
+	void Reset() { Entries.Reset(); }
+
+private:
+	TMap<const UClass*, FEntry> Entries;
+};
+
+/** Times one ValidateLoadedAsset call, returned by UBlueprintValidatorBase::BeginIssues */
+class FValidatorXValidationScope
+{
+public:
+	explicit FValidatorXValidationScope(const UClass* InValidator)
+		: Validator(InValidator)
+		, StartProblems(FValidatorXValidatorStats::Get().GetNumProblems(InValidator))
+		, StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FValidatorXValidationScope()
+	{
+		// Info notes are annotations, only warnings and errors make a hit
+		FValidatorXValidatorStats& Stats = FValidatorXValidatorStats::Get();
+		Stats.AddValidation(Validator, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles), Stats.GetNumProblems(Validator) > StartProblems);
+	}
+
+	FValidatorXValidationScope(const FValidatorXValidationScope&) = delete;
+	FValidatorXValidationScope& operator=(const FValidatorXValidationScope&) = delete;
+
+private:
+	const UClass* Validator;
+	int32 StartProblems;
+	uint64 StartCycles;
+};
@@ -6,6 +6,7 @@
 #include "Modules/ModuleManager.h"
 
 class UBlueprintValidatorBase;
+struct FAssetData;
 
 
 class IValidatorXModule : public IModuleInterface
@@ -31,6 +32,21 @@ protected:
 	virtual void OpenManagerTab() override;
 	void RegisterMenus();
 
+	/** Compiles the Blueprints selected in the Content Browser with timing (see CompileProfiler) */
+	void ProfileSelectedBlueprints();
+
+	/** Validates the Blueprints selected in the Content Browser, or every Blueprint under the given folders */
+	void ValidateSelectedBlueprints();
+	void ValidateFolders(TArray<FString> PackagePaths);
+
+	/**
+	 * Runs the validators enabled in the ValidatorX tab on the Blueprints among Assets behind a cancellable slow
+	 * task. A cancel stops between assets or between validators of one asset; everything found until then is kept.
+	 */
+	void ValidateAssets(TArray<FAssetData> Assets);
+
 	/** Validators */
 	TArray <TSharedPtr<UBlueprintValidatorBase>> Validators;
+
+	FDelegateHandle PackageSavedHandle;
 };
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UBlueprintValidatorBase;
+
+/**
+ * Low-priority pass validating every Blueprint of the project in the editor, a few at a time while the user is idle.
+ *
+ * Open assets go first, then the most recently modified packages. Packages are loaded asynchronously ahead of
+ * validation, so the editor never waits on a load, and each tick runs one validator on one loaded asset at a time
+ * until its time budget is spent, so a Blueprint spreads over several frames when its validators are slow. Scanned
+ * packages are left to the engine's regular garbage collection.
+ * Results land in the issue log and the subgraph hash table like any other validation, and OnProgress lets the
+ * ValidatorX tab follow along. Started from the tab, or at startup with -ValidatorXBackgroundScan.
+ */
+class VALIDATORX_API FValidatorXBackgroundScan
+{
+	FValidatorXBackgroundScan() {}
+	FValidatorXBackgroundScan(const FValidatorXBackgroundScan&) = delete;
+	FValidatorXBackgroundScan& operator=(const FValidatorXBackgroundScan&) = delete;
+
+public:
+	static FValidatorXBackgroundScan& Get()
+	{
+		static FValidatorXBackgroundScan Instance;
+		return Instance;
+	}
+
+	/** Queues the Blueprints under /Game not validated in this session yet, waits for the asset registry if needed */
+	void Start();
+
+	/** Drops the queue and the loads in flight; the results so far are kept and the subgraph table is saved */
+	void Stop();
+
+	bool IsRunning() const { return TickHandle.IsValid() || RegistryHandle.IsValid(); }
+
+	/** True while the user interacts with the editor or plays in editor */
+	bool IsPaused() const { return bPaused; }
+
+	int32 NumValidated() const { return NextIndex; }
+	int32 NumQueued() const { return Queue.Num(); }
+
+	/** Progress line shown in the ValidatorX tab */
+	FText GetStatusText() const;
+
+	/** Broadcast at most once a second while assets are validated, and when the scan ends */
+	FSimpleMulticastDelegate& OnProgress() { return ProgressEvent; }
+
+private:
+	void BuildQueue();
+	bool Tick(float DeltaTime);
+
+	/** No input for IdleDelay seconds, no play session, no modal window */
+	bool IsEditorIdle() const;
+
+	void RequestLoads();
+	/** Runs the next validator on the current asset, done with the asset after the last one */
+	void ValidateStep();
+	void Finish();
+
+	/** Assets in validation order */
+	TArray<FAssetData> Queue;
+	int32 NextIndex = 0;
+	int32 NextRequest = 0;
+
+	/** Tells the loads of a stopped scan apart from those of the current one */
+	uint32 ScanSerial = 0;
+
+	/** Assets of finished loads by queue index, held until validated; invalid when the load failed */
+	TMap<int32, TStrongObjectPtr<UObject>> LoadedAssets;
+
+	/** Own instances, the editor ones may be disabled from the ValidatorX tab */
+	TArray<TStrongObjectPtr<UBlueprintValidatorBase>> Validators;
+
+	/** Asset of Queue[NextIndex] while its validators run, and the next of them */
+	TStrongObjectPtr<UObject> CurrentAsset;
+	int32 NextValidator = 0;
+
+	FTSTicker::FDelegateHandle TickHandle;
+	FDelegateHandle RegistryHandle;
+	FSimpleMulticastDelegate ProgressEvent;
+
+	/** Seconds of validation per frame, seconds without input before resuming, loads kept in flight */
+	double BudgetSeconds = 0.004;
+	double IdleDelay = 2.0;
+	int32 LoadAhead = 2;
+
+	double LastProgressTime = 0.0;
+	double StartTime = 0.0;
+	double ScanSeconds = 0.0;
+	bool bPaused = false;
+};
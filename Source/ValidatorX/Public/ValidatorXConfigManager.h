@@ -0,0 +1,103 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprintValidatorBase;
+
+/** Named set of enabled validators, applied as a whole from the ValidatorX tab or the command line */
+struct FValidatorXPreset
+{
+	FName Name;
+	FText DisplayName;
+	FText Description;
+
+	/** Fail-fast on save (see ValidatorSchedule) while the preset is active */
+	bool bFailFast = false;
+
+	/** True when the validator, given as its class default object, is part of the preset */
+	TFunction<bool(const UBlueprintValidatorBase*)> IncludesValidator;
+};
+
+/**
+ * Owns the enabled state of the validators as a whole.
+ *
+ * Toggling a validator writes its bIsEnabled to the editor config. Inside an FBatchScope the writes only go to the
+ * config cache and the files are flushed once when the outermost scope ends, so switching a preset or every
+ * validator at once costs one write instead of one per validator. Presets: SaveTimeFast, CIFull and PerfAudit,
+ * applied at startup with -ValidatorXPreset=<Name>.
+ *
+ * The class default objects of the validators are gathered once and again after a hot reload, and the active preset
+ * is only matched again after a toggle or a fail-fast change, the ValidatorX tab asks for it every frame.
+ */
+class VALIDATORX_API FValidatorXConfigManager
+{
+	FValidatorXConfigManager();
+	FValidatorXConfigManager(const FValidatorXConfigManager&) = delete;
+	FValidatorXConfigManager& operator=(const FValidatorXConfigManager&) = delete;
+
+public:
+	static FValidatorXConfigManager& Get()
+	{
+		static FValidatorXConfigManager Instance;
+		return Instance;
+	}
+
+	/** Defers the config writes of every toggle until the outermost scope ends */
+	struct FBatchScope
+	{
+		FBatchScope() { Get().NumBatches++; }
+		~FBatchScope()
+		{
+			if(--Get().NumBatches == 0)
+			{
+				Get().Flush();
+			}
+		}
+	};
+
+	/** Stores bIsEnabled of a validator class in the config, written right away outside of a batch */
+	void WriteEnabled(const UClass* Validator, bool bEnabled);
+
+	/** Class default objects of every concrete validator */
+	const TArray<UBlueprintValidatorBase*>& GetValidatorDefaults() const;
+
+	/** Enables or disables every validator with one config write */
+	void SetAllEnabled(bool bEnabled);
+
+	const TArray<FValidatorXPreset>& GetPresets() const { return Presets; }
+
+	/** Preset by name, case insensitive; null when there is none */
+	const FValidatorXPreset* FindPreset(FName Name) const;
+
+	/**
+	 * Enables exactly the validators of the preset and sets its fail-fast policy, with one config write.
+	 *
+	 * @return False when there is no preset of that name
+	 */
+	bool ApplyPreset(FName Name);
+
+	/** Preset the current toggles and fail-fast policy match, null when they were customised */
+	const FValidatorXPreset* GetActivePreset() const;
+
+	/** Applies -ValidatorXPreset= when given */
+	void ApplyCommandLinePreset();
+
+private:
+	void Flush();
+
+	TArray<FValidatorXPreset> Presets;
+
+	/** Filled on first use, emptied when classes are reloaded */
+	mutable TArray<UBlueprintValidatorBase*> ValidatorDefaults;
+
+	/** Match of the toggles and the fail-fast policy of CachedFailFast, valid until bActivePresetDirty */
+	mutable const FValidatorXPreset* ActivePreset = nullptr;
+	mutable bool bCachedFailFast = false;
+	mutable bool bActivePresetDirty = true;
+
+	/** Config files written to the cache since the last flush */
+	TSet<FString> DirtyConfigFiles;
+	int32 NumBatches = 0;
+};
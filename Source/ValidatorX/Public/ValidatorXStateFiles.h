@@ -0,0 +1,26 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FArchive;
+
+/**
+ * Writing of the files ValidatorX keeps in Saved/ValidatorX across runs (subgraph hash table, validator schedule,
+ * baselines). Several processes may share them, the shards of the commandlet's Launch mode in particular.
+ */
+namespace ValidatorX
+{
+	/** False with -ValidatorXNoPersist, which Launch gives its shards so they leave the shared files alone */
+	VALIDATORX_API bool IsPersistingState();
+
+	/**
+	 * Writes the file under a temporary name next to it and moves it over FilePath, so no reader or concurrent
+	 * writer ever sees a partial file.
+	 */
+	VALIDATORX_API bool SaveStringAtomically(const FString& Text, const FString& FilePath);
+
+	/** Same for binary content; Write serializes into the temporary file */
+	VALIDATORX_API bool SaveArchiveAtomically(const FString& FilePath, TFunctionRef<void(FArchive&)> Write);
+}
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "AnimBlueprintCostValidator.generated.h"
+
+/**
+ * Animation Blueprint validator for game-thread cost: finds anim node pins bound to logic that
+ * is not on the fast path, heavy nodes in BlueprintUpdateAnimation, reports which of that work could
+ * move to BlueprintThreadSafeUpdateAnimation, and summarises the estimated game-thread cost.
+ */
+UCLASS()
+class VALIDATORX_API UAnimBlueprintCostValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual FString GetTypeValidator() const override
+	{
+		return TEXT("AnimBlueprint");
+	}
+
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: only Animation Blueprints */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Estimated node cost (see BlueprintCostModel) from which a node in BlueprintUpdateAnimation is reported as heavy */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 HeavyNodeCost = 20;
+
+	/** Estimated game-thread cost per update above which the Animation Blueprint is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 GameThreadCostBudget = 60;
+};
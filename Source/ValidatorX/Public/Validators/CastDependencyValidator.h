@@ -0,0 +1,59 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "CastDependencyValidator.generated.h"
+
+/**
+ * Finds cast nodes, class-typed variables and object pins that hard-reference heavy Blueprint classes,
+ * ranks the referenced classes by load closure size and dependency count, and suggests replacing
+ * them with an interface call or a soft reference.
+ */
+UCLASS()
+class VALIDATORX_API UCastDependencyValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: skips data-only Blueprints, they have no graphs or variables */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Walks the dependency closure of every cast target */
+	virtual bool IsExpensive() const override { return true; }
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Closure size on disk (in megabytes) above which a referenced Blueprint class counts as heavy */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "0"))
+	float HeavyClassThresholdMB = 8.0f;
+
+	/** Closure package count above which a referenced Blueprint class counts as heavy, regardless of its size */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 HeavyClassDependencyCount = 200;
+};
@@ -15,18 +15,6 @@ class VALIDATORX_API UCircularDependencyValidator : public UBlueprintValidatorBa
 	GENERATED_BODY()
 
 public:
-	UCircularDependencyValidator();
-
-	virtual void SetValidationEnabled(bool bEnabled) override;
-
-
-	/**
-	 * Checks if the validator is currently enabled.
-	 *
-	 * @return True if validation is active
-	 */
-	virtual bool IsEnabled() const override;
-
 	/**
 	 * Checks whether this validator can validate the given asset.
 	 *
@@ -47,6 +35,9 @@ public:
 	 */
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
 
 private:
 	bool HasCircularDependency(UBlueprint* Blueprint, FDataValidationContext& Context);
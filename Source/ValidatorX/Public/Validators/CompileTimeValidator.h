@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "CompileTimeValidator.generated.h"
+
+/**
+ * Flags Blueprints whose measured Kismet compile time exceeds a budget (see CompileProfiler).
+ * Measurements come from the compile profiler history filled by the "Profile Blueprint Compile Times"
+ * menu entry or the commandlet; the report includes the structural metrics and the previous measurement.
+ */
+UCLASS()
+class VALIDATORX_API UCompileTimeValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Compile time in milliseconds above which a Blueprint is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	float CompileBudgetMs = 250.0f;
+
+	/** Compiles Blueprints that were never measured during validation. Slow, meant for batch runs. */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX")
+	bool bCompileWhenUnmeasured = false;
+};
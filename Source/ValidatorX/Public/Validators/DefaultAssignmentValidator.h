@@ -14,28 +14,6 @@ class VALIDATORX_API UDefaultAssignmentValidator : public UBlueprintValidatorBas
 {
 	GENERATED_BODY()
 public:
-	UDefaultAssignmentValidator();
-
-	virtual void SetValidationEnabled(bool bEnabled) override
-	{
-		static UDefaultAssignmentValidator* CDO = GetMutableDefault<UDefaultAssignmentValidator>();
-		if(bIsConfigDisabled)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Validator is disabled by config!"));
-			return;
-		}
-
-		CDO->bIsEnabled = bEnabled;
-		SaveConfig();
-	}
-
-
-	/**
-	 * Checks if the validator is currently enabled.
-	 *
-	 * @return True if validation is active
-	 */
-	virtual bool IsEnabled() const override;
 
 	/**
 	 * Checks whether this validator can validate the given asset.
@@ -47,6 +25,9 @@ public:
 	 */
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
 
+	/** Registry-only check: skips data-only Blueprints, they have no graphs */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
 	/**
 	 * Performs validation on a loaded asset.
 	 *
@@ -57,4 +38,7 @@ public:
 	 */
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
 };
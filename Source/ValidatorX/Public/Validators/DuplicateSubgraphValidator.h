@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "DuplicateSubgraphValidator.generated.h"
+
+/**
+ * Hashes every node cluster of a Blueprint with a canonical Merkle hash (see SubgraphHasher) and reports
+ * identical clusters within the Blueprint, near-identical ones that only differ in literal pin values,
+ * and clusters already seen in other Blueprints of the project. These are candidates for shared
+ * functions, macros or a function library.
+ */
+UCLASS()
+class VALIDATORX_API UDuplicateSubgraphValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: skips data-only Blueprints, they have no graphs */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Hashes every graph and looks the clusters up in the project-wide table */
+	virtual bool IsExpensive() const override { return true; }
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Clusters smaller than this many nodes are not reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "2"))
+	int32 MinClusterNodes = 6;
+
+	/** Number of consecutive exec steps hashed into one exec cluster */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 ClusterChainLength = 4;
+
+	/** Records cluster hashes in the project-wide table and reports clusters duplicated in other Blueprints */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX")
+	bool bProjectWideDuplicates = true;
+
+	/** Maximum number of duplicate groups reported per Blueprint */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 MaxReportedGroups = 10;
+};
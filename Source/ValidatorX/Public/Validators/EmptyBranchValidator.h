@@ -15,28 +15,6 @@ class VALIDATORX_API UEmptyBranchValidator : public UBlueprintValidatorBase
 	GENERATED_BODY()
 
 public:
-	UEmptyBranchValidator();
-
-	virtual void SetValidationEnabled(bool bEnabled) override
-	{
-		static UEmptyBranchValidator* CDO = GetMutableDefault<UEmptyBranchValidator>();
-		if(bIsConfigDisabled)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Validator is disabled by config!"));
-			return;
-		}
-
-		CDO->bIsEnabled = bEnabled;
-		SaveConfig();
-	}
-
-
-	/**
-	 * Checks if the validator is currently enabled.
-	 *
-	 * @return True if validation is active
-	 */
-	virtual bool IsEnabled() const override;
 
 	/**
 	 * Checks whether this validator can validate the given asset.
@@ -48,6 +26,9 @@ public:
 	 */
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
 
+	/** Registry-only check: skips data-only Blueprints, they have no graphs */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
 	/**
 	 * Performs validation on a loaded asset.
 	 *
@@ -57,5 +38,8 @@ public:
 	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
 	 */
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
 	
 };
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "HardReferenceSizeValidator.generated.h"
+
+/**
+ * Flags Blueprints whose transitive hard-dependency closure (read from the asset registry,
+ * nothing is loaded) exceeds a disk size budget, and names the references that contribute most.
+ */
+UCLASS()
+class VALIDATORX_API UHardReferenceSizeValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Walks the hard dependency closure through the asset registry */
+	virtual bool IsExpensive() const override { return true; }
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Closure size on disk (in megabytes) above which a Blueprint is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	float ClosureBudgetMB = 64.0f;
+
+	/** How many of the heaviest referenced packages are listed for a Blueprint over budget, each once */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 MaxReportedReferences = 5;
+};
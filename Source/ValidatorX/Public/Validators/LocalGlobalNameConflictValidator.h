@@ -15,28 +15,6 @@ class VALIDATORX_API ULocalGlobalNameConflictValidator : public UBlueprintValida
 	GENERATED_BODY()
 	
 public:
-	ULocalGlobalNameConflictValidator();
-
-	virtual void SetValidationEnabled(bool bEnabled) override
-	{
-		static ULocalGlobalNameConflictValidator* CDO = GetMutableDefault<ULocalGlobalNameConflictValidator>();
-		if(bIsConfigDisabled)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Validator is disabled by config!"));
-			return;
-		}
-
-		CDO->bIsEnabled = bEnabled;
-		SaveConfig();
-	}
-
-	/**
-	 * Checks if the validator is currently enabled.
-	 *
-	 * @return True if validation is active
-	 */
-	virtual bool IsEnabled() const override;
-	
 	/**
 	 * Checks whether this validator can validate the given asset.
 	 *
@@ -47,6 +25,9 @@ public:
 	 */
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
 
+	/** Registry-only check: skips Blueprints saved without member variables or functions */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
 	/**
 	 * Performs validation on a loaded asset.
 	 *
@@ -57,4 +38,13 @@ public:
 	 */
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Every issue of this validator can be fixed from its message */
+	virtual bool HasIssueFix(const FValidatorXIssue& Issue) const override { return true; }
+
 };
@@ -14,28 +14,6 @@ class VALIDATORX_API ULocalVariableNeverUsedValidator : public UBlueprintValidat
 {
 	GENERATED_BODY()
 public:
-	ULocalVariableNeverUsedValidator();
-
-	virtual void SetValidationEnabled(bool bEnabled) override
-	{
-		static ULocalVariableNeverUsedValidator* CDO = GetMutableDefault<ULocalVariableNeverUsedValidator>();
-		if(bIsConfigDisabled)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Validator is disabled by config!"));
-			return;
-		}
-
-		CDO->bIsEnabled = bEnabled;
-		SaveConfig();
-	}
-
-	/**
-	 * Checks if the validator is currently enabled.
-	 *
-	 * @return True if validation is active
-	 */
-	virtual bool IsEnabled() const override;
-
 	/**
 	 * Checks whether this validator can validate the given asset.
 	 *
@@ -46,6 +24,9 @@ public:
 	 */
 	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
 
+	/** Registry-only check: skips Blueprints saved without functions, the only graphs with local variables */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
 	/**
 	 * Performs validation on a loaded asset.
 	 *
@@ -56,4 +37,13 @@ public:
 	 */
 	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
 
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Every issue of this validator can be fixed from its message */
+	virtual bool HasIssueFix(const FValidatorXIssue& Issue) const override { return true; }
+
 };
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "LoopNestingValidator.generated.h"
+
+/**
+ * Builds loop structure over exec flow (loop macros, and event/Delay loops found as natural loops
+ * of the dominator tree) and flags nested loops, linear array searches inside loops, and object
+ * creation inside loops as pooling candidates.
+ */
+UCLASS()
+class VALIDATORX_API ULoopNestingValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: skips data-only Blueprints, they have no graphs */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Loops nested deeper than this are reported (1 means any loop inside another loop) */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 MaxLoopDepth = 1;
+};
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "ReplicationCostValidator.generated.h"
+
+/**
+ * Reports replicated variables and RPC custom events that are expensive for the network:
+ * reliable multicast/client RPCs reachable from Tick, replicated arrays or structs written every frame,
+ * unconditioned replicated properties on frequently ticking actors, and the estimated per-class footprint.
+ */
+UCLASS()
+class VALIDATORX_API UReplicationCostValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: only Blueprints of actors and components, the only classes that replicate */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Actors ticking at this interval (in seconds) or faster count as frequently ticking */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "0"))
+	float FrequentTickInterval = 0.1f;
+
+	/** Emit the per-class replication footprint even when nothing else is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX")
+	bool bAlwaysReportFootprint = true;
+};
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BaseClasses/BlueprintValidatorBase.h"
+#include "WidgetBindingValidator.generated.h"
+
+/**
+ * Widget Blueprint validator for per-frame UI cost: flags binding functions over the cost budget and widget
+ * creation or widget tree queries inside Tick or bindings, and reports the total number of bindings evaluated
+ * by a widget tree including nested user widgets, once per widget.
+ */
+UCLASS()
+class VALIDATORX_API UWidgetBindingValidator : public UBlueprintValidatorBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual FString GetTypeValidator() const override
+	{
+		return TEXT("WidgetBlueprint");
+	}
+
+	/**
+	 * Checks whether this validator can validate the given asset.
+	 *
+	 * @param InAssetData   Asset metadata (path, type, etc.)
+	 * @param InObject      Loaded asset object (null if not loaded)
+	 * @param InContext     Validation context for error/warning accumulation
+	 * @return True if this validator should process the asset
+	 */
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& InContext) const override;
+
+	/** Registry-only check: only Widget Blueprints */
+	virtual bool CanValidateAssetData(const FAssetData& InAssetData) const override;
+
+	/**
+	 * Performs validation on a loaded asset.
+	 *
+	 * @param InAssetData   Asset metadata
+	 * @param InAsset       Loaded asset object
+	 * @param Context       Validation context for reporting issues
+	 * @return EDataValidationResult::Passed if valid, Failed/Invalid otherwise
+	 */
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+
+	/** Formats a recorded issue when it is displayed */
+	virtual FText FormatIssue(const FValidatorXIssue& Issue) const override;
+
+	/** Adds the jump and fix tokens of a displayed issue */
+	virtual void AddIssueTokens(const FValidatorXIssue& Issue, FTokenizedMessage& Message) const override;
+
+	/** Estimated cost (see BlueprintCostModel) above which a single binding function is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 BindingCostBudget = 15;
+
+	/** Total bindings evaluated per frame by a widget tree, nested user widgets included, above which it is reported */
+	UPROPERTY(Config, EditAnywhere, Category = "ValidatorX", meta = (ClampMin = "1"))
+	int32 MaxBindingsPerTree = 50;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Styling/SlateTypes.h"
 #include "Widgets/SCompoundWidget.h"
 
 class UBlueprintValidatorBase;
@@ -28,4 +29,14 @@ private:
 	FSlateFontInfo FontInfo;
 
 	TSharedRef<ITableRow> OnGenerateRowForList(TWeakObjectPtr<UBlueprintValidatorBase> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Checked when every validator is enabled, undetermined when only some are */
+	ECheckBoxState GetAllEnabledState() const;
+
+	/** Name of the preset the toggles match, "Custom" otherwise */
+	FText GetPresetText() const;
+	TSharedRef<SWidget> MakePresetMenu();
+
+	/** Writes the issue log into Saved/ValidatorX/<FileName>, SARIF or JSON lines depending on the extension */
+	FReply OnExportReport(FString FileName);
 };
@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Reporting/HealthTable.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class SSearchBox;
+
+/** Row of the dashboard list: an index into the table rows or into the groups, depending on the grouping */
+struct FValidatorXDashboardItem
+{
+	int32 Index = 0;
+};
+
+/**
+ * Project health panel of the ValidatorX tab: one row per Blueprint with its registry metrics and issue count,
+ * optionally grouped by folder or validator. Sorting, filtering and grouping run on FValidatorXHealthTable; the
+ * list only holds one shared item per table row, created once, and generates widgets for the visible rows only.
+ */
+class VALIDATORX_API SValidatorXDashboard : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXDashboard) {}
+	SLATE_END_ARGS()
+
+	enum class EGroupMode : uint8
+	{
+		None,
+		Folder,
+		Validator
+	};
+
+	void Construct(const FArguments& InArgs);
+
+	/** Text of a cell, used by the rows */
+	FText GetCellText(const FValidatorXDashboardItem& Item, EValidatorXHealthColumn Column) const;
+
+private:
+	/** Reads the registry again */
+	FReply OnRebuild();
+
+	/** Picks up the issue counts of the assets the background scan validated */
+	void OnScanProgress();
+
+	/** Starts or stops the background scan */
+	FReply OnToggleScan();
+
+	/**
+	 * Queries, sorts and groups the table into the list.
+	 *
+	 * @param bNarrow   The filter only got longer: narrows the current rows, which stay sorted
+	 */
+	void Refresh(bool bNarrow = false);
+
+	void OnFilterTextChanged(const FText& Text);
+	void OnGroupModeChanged(EGroupMode NewMode);
+	void OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& ColumnId, EColumnSortMode::Type NewSortMode);
+	EColumnSortMode::Type GetColumnSortMode(FName ColumnId) const;
+
+	/** Asset rows open their first issue or the asset, group rows show their assets */
+	void OnItemDoubleClicked(TSharedPtr<FValidatorXDashboardItem> Item);
+	void OpenRow(int32 Row) const;
+
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FValidatorXDashboardItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	FText GetSummaryText() const;
+
+	FValidatorXHealthTable Table;
+
+	/** Sorted table rows matching the filters */
+	TArray<int32> Rows;
+	TArray<FValidatorXHealthTable::FGroup> Groups;
+
+	/** Item k has index k; the list source points into it */
+	TArray<TSharedPtr<FValidatorXDashboardItem>> ItemPool;
+	TArray<TSharedPtr<FValidatorXDashboardItem>> VisibleItems;
+
+	FString FilterText;
+	int32 ValidatorFilter = INDEX_NONE;
+	EGroupMode GroupMode = EGroupMode::None;
+	EGroupMode DisplayedGroupMode = EGroupMode::None;
+	EValidatorXHealthColumn SortColumn = EValidatorXHealthColumn::Issues;
+	EColumnSortMode::Type SortMode = EColumnSortMode::Descending;
+
+	TSharedPtr<SListView<TSharedPtr<FValidatorXDashboardItem>>> ListView;
+	TSharedPtr<SSearchBox> SearchBox;
+};
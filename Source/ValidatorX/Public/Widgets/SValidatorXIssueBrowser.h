@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Reporting/IssueLog.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/** Row of the issue browser list, an index into FValidatorXIssueTable */
+struct FValidatorXIssueBrowserItem
+{
+	int32 Row = 0;
+};
+
+/**
+ * Issues panel of the ValidatorX tab, the Message Log replacement for large result sets. Reads the FValidatorXIssueTable
+ * of the issue log in place: search and facets filter row indices, and messages are only formatted for the rows on
+ * screen. Refresh picks up the issues reported since the last one.
+ */
+class VALIDATORX_API SValidatorXIssueBrowser : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXIssueBrowser) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	/** Text of a cell, used by the rows */
+	FText GetCellText(int32 Row, FName ColumnId) const;
+
+private:
+	/** Enables every facet value and lists the current issues */
+	FReply OnRebuild();
+
+	/** Adds items and enabled facet values for the rows and values added to the table since the last refresh */
+	void SyncWithTable();
+
+	/**
+	 * Runs the search, then the facets.
+	 *
+	 * @param bNarrow   The search only got longer: narrows the current search results
+	 */
+	void Refresh(bool bNarrow = false);
+
+	/** Applies the facets to the search results and updates the list */
+	void RefreshFacets();
+
+	void OnSearchTextChanged(const FText& Text);
+
+	ECheckBoxState GetSeverityState(EMessageSeverity::Type Severity) const;
+	void OnSeverityStateChanged(ECheckBoxState NewState, EMessageSeverity::Type Severity);
+	FText GetSeverityLabel(EMessageSeverity::Type Severity) const;
+
+	/** Checkable menu of the validator or folder facet values with their match counts */
+	TSharedRef<SWidget> MakeFacetMenu(bool bValidators);
+
+	void OnItemDoubleClicked(TSharedPtr<FValidatorXIssueBrowserItem> Item);
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FValidatorXIssueBrowserItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	FText GetSummaryText() const;
+
+	const FValidatorXIssueTable& Table = FValidatorXIssueLog::Get().GetTable();
+	FValidatorXIssueTable::FFacets Facets;
+
+	/** Layout of the table the row indices refer to */
+	uint32 LayoutVersion = 0;
+
+	/** Rows matching the search, and among them the rows matching the facets */
+	TArray<int32> SearchRows;
+	TArray<int32> Rows;
+
+	/** Search matches per facet value */
+	TArray<int32> SeverityCounts;
+	TArray<int32> ValidatorCounts;
+	TArray<int32> FolderCounts;
+
+	/** Item k has row k, allocated once per row and shared by every refresh */
+	TArray<TSharedPtr<FValidatorXIssueBrowserItem>> ItemPool;
+	TArray<TSharedPtr<FValidatorXIssueBrowserItem>> VisibleItems;
+
+	FString SearchText;
+
+	TSharedPtr<SListView<TSharedPtr<FValidatorXIssueBrowserItem>>> ListView;
+};
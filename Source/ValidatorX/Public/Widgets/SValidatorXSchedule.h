@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/** Row of the schedule list, one validator class */
+struct FValidatorXScheduleItem
+{
+	const UClass* Validator = nullptr;
+	int32 Order = 0;
+};
+
+/**
+ * Validator schedule panel of the ValidatorX tab: every validator in execution order with its measured cost and hit
+ * rate (see FValidatorXValidatorSchedule), and the fail-fast toggle for save-time validation.
+ */
+class VALIDATORX_API SValidatorXSchedule : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SValidatorXSchedule) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/** Text of a cell, used by the rows */
+	FText GetCellText(const FValidatorXScheduleItem& Item, FName ColumnId) const;
+
+private:
+	/** Orders the validators by their current measurements */
+	FReply OnRefresh();
+
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FValidatorXScheduleItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	TArray<TSharedPtr<FValidatorXScheduleItem>> Items;
+	TSharedPtr<SListView<TSharedPtr<FValidatorXScheduleItem>>> ListView;
+};
@@ -43,7 +43,13 @@ public class ValidatorX : ModuleRules
 				"EditorStyle", 
 				"LevelEditor",
 				"InputCore",
-				"ToolMenus"
+				"ToolMenus",
+				"AssetRegistry",
+				"UMG",
+				"UMGEditor",
+				"AnimGraph",
+				"ContentBrowser",
+				"Json"
 			}
 			);
 		